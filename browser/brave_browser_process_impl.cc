@@ -167,6 +167,11 @@ void BraveBrowserProcessImpl::Init() {
 
 #if !BUILDFLAG(IS_ANDROID)
 void BraveBrowserProcessImpl::StartTearDown() {
+  // Local state is committed by the base class, store what P3A still holds
+  // before that.
+  if (brave_p3a_service_) {
+    brave_p3a_service_->Shutdown();
+  }
   ad_block_service_.reset();
   brave_stats_updater_.reset();
   brave_referrals_service_.reset();
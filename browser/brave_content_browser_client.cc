@@ -19,6 +19,7 @@
 #include "brave/browser/brave_browser_main_extra_parts.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
+#include "brave/browser/brave_shields/shields_settings_cache_factory.h"
 #include "brave/browser/brave_wallet/brave_wallet_context_utils.h"
 #include "brave/browser/brave_wallet/brave_wallet_provider_delegate_impl.h"
 #include "brave/browser/brave_wallet/brave_wallet_service_factory.h"
@@ -48,6 +49,7 @@
 #include "brave/components/brave_shields/browser/brave_farbling_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/browser/domain_block_navigation_throttle.h"
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/brave_shields/common/features.h"
 #include "brave/components/brave_vpn/common/buildflags/buildflags.h"
@@ -505,14 +507,13 @@ bool BraveContentBrowserClient::AllowWorkerFingerprinting(
 uint8_t BraveContentBrowserClient::WorkerGetBraveFarblingLevel(
     const GURL& url,
     content::BrowserContext* browser_context) {
-  HostContentSettingsMap* host_content_settings_map =
-      HostContentSettingsMapFactory::GetForProfile(browser_context);
-  const bool shields_up =
-      brave_shields::GetBraveShieldsEnabled(host_content_settings_map, url);
-  if (!shields_up)
+  const auto shields_settings =
+      brave_shields::ShieldsSettingsCacheFactory::GetForBrowserContext(
+          browser_context)
+          ->Get(url);
+  if (!shields_settings.shields_enabled)
     return BraveFarblingLevel::OFF;
-  auto fingerprinting_type = brave_shields::GetFingerprintingControlType(
-      host_content_settings_map, url);
+  const auto fingerprinting_type = shields_settings.fingerprinting_control_type;
   if (fingerprinting_type == ControlType::BLOCK)
     return BraveFarblingLevel::MAXIMUM;
   if (fingerprinting_type == ControlType::ALLOW)
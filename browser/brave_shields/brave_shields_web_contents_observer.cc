@@ -9,6 +9,7 @@
 #include <string>
 #include <utility>
 
+#include "base/bind.h"
 #include "base/feature_list.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/brave_perf_predictor/browser/perf_predictor_tab_helper.h"
@@ -43,6 +44,10 @@ namespace {
 
 BraveShieldsWebContentsObserver* g_receiver_impl_for_testing = nullptr;
 
+// Roughly one frame at 60Hz, so the shields panel and icon still update as
+// smoothly as if every event were reported on its own.
+constexpr base::TimeDelta kBlockedEventsFlushInterval = base::Milliseconds(16);
+
 }  // namespace
 
 BraveShieldsWebContentsObserver::~BraveShieldsWebContentsObserver() {
@@ -96,6 +101,29 @@ void BraveShieldsWebContentsObserver::AddBlockedSubresource(
   blocked_url_paths_.insert(subresource);
 }
 
+void BraveShieldsWebContentsObserver::AddPendingBlockedEvent(
+    const std::string& block_type,
+    const std::string& subresource) {
+  pending_blocked_events_.emplace_back(block_type, subresource);
+  if (!flush_blocked_events_timer_.IsRunning()) {
+    flush_blocked_events_timer_.Start(
+        FROM_HERE, kBlockedEventsFlushInterval,
+        base::BindOnce(
+            &BraveShieldsWebContentsObserver::FlushPendingBlockedEvents,
+            base::Unretained(this)));
+  }
+}
+
+void BraveShieldsWebContentsObserver::FlushPendingBlockedEvents() {
+  flush_blocked_events_timer_.Stop();
+  if (pending_blocked_events_.empty())
+    return;
+
+  BlockedEvents blocked_events;
+  blocked_events.swap(pending_blocked_events_);
+  DispatchBlockedEventsForWebContents(blocked_events, web_contents());
+}
+
 // static
 void BraveShieldsWebContentsObserver::BindBraveShieldsHost(
     mojo::PendingAssociatedReceiver<brave_shields::mojom::BraveShieldsHost>
@@ -127,11 +155,12 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
   auto subresource = request_url.spec();
   WebContents* web_contents =
       WebContents::FromFrameTreeNodeId(frame_tree_node_id);
-  DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
 
   if (web_contents) {
     BraveShieldsWebContentsObserver* observer =
         BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+    if (observer)
+      observer->AddPendingBlockedEvent(block_type, subresource);
     if (observer && !observer->IsBlockedSubresource(subresource)) {
       observer->AddBlockedSubresource(subresource);
       PrefService* prefs =
@@ -158,9 +187,8 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
 
 #if !BUILDFLAG(IS_ANDROID)
 // static
-void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
-    const std::string& block_type,
-    const std::string& subresource,
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedEvents& blocked_events,
     WebContents* web_contents) {
   if (!web_contents)
     return;
@@ -170,7 +198,7 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
   // component layer - We don't attach any tab helpers in this case.
   if (!shields_data_ctrlr)
     return;
-  shields_data_ctrlr->HandleItemBlocked(block_type, subresource);
+  shields_data_ctrlr->HandleItemsBlocked(blocked_events);
 }
 #endif
 
@@ -181,8 +209,8 @@ void BraveShieldsWebContentsObserver::OnJavaScriptBlocked(
   if (!web_contents)
     return;
 
-  DispatchBlockedEventForWebContents(brave_shields::kJavaScript,
-                                     base::UTF16ToUTF8(details), web_contents);
+  AddPendingBlockedEvent(brave_shields::kJavaScript,
+                         base::UTF16ToUTF8(details));
 }
 
 // static
@@ -201,6 +229,9 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
   content::ReloadType reload_type = navigation_handle->GetReloadType();
   if (navigation_handle->IsInMainFrame() &&
       !navigation_handle->IsSameDocument()) {
+    // Report what the previous page blocked before the UI resets its lists
+    // for the new one.
+    FlushPendingBlockedEvents();
     if (reload_type == content::ReloadType::NONE) {
       // For new loads, we reset the counters for both blocked scripts and URLs.
       allowed_script_origins_.clear();
@@ -9,10 +9,12 @@
 #include <map>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/synchronization/lock.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_shields/common/brave_shields.mojom.h"
 #include "content/public/browser/render_frame_host_receiver_set.h"
 #include "content/public/browser/web_contents_observer.h"
@@ -43,10 +45,13 @@ class BraveShieldsWebContentsObserver
           receiver,
       content::RenderFrameHost* rfh);
 
+  // Blocked subresources paired with their block type, in the order they
+  // were blocked. A subresource blocked repeatedly is listed every time.
+  using BlockedEvents = std::vector<std::pair<std::string, std::string>>;
+
   static void RegisterProfilePrefs(PrefRegistrySimple* registry);
-  static void DispatchBlockedEventForWebContents(
-      const std::string& block_type,
-      const std::string& subresource,
+  static void DispatchBlockedEventsForWebContents(
+      const BlockedEvents& blocked_events,
       content::WebContents* web_contents);
   static void DispatchBlockedEvent(const GURL& request_url,
                                    int frame_tree_node_id,
@@ -56,6 +61,11 @@ class BraveShieldsWebContentsObserver
                         content::WebContents* web_contents);
   bool IsBlockedSubresource(const std::string& subresource);
   void AddBlockedSubresource(const std::string& subresource);
+  // Queues a blocked event for the UI. Pages can block thousands of requests
+  // while loading, so events are reported in batches at most once per frame
+  // interval.
+  void AddPendingBlockedEvent(const std::string& block_type,
+                              const std::string& subresource);
 
  protected:
   // content::WebContentsObserver overrides.
@@ -93,11 +103,16 @@ class BraveShieldsWebContentsObserver
   mojo::AssociatedRemote<brave_shields::mojom::BraveShields>&
   GetBraveShieldsRemote(content::RenderFrameHost* rfh);
 
+  void FlushPendingBlockedEvents();
+
   std::vector<std::string> allowed_script_origins_;
   // We keep a set of the current page's blocked URLs in case the page
   // continually tries to load the same blocked URLs.
   std::set<std::string> blocked_url_paths_;
 
+  BlockedEvents pending_blocked_events_;
+  base::OneShotTimer flush_blocked_events_timer_;
+
   content::RenderFrameHostReceiverSet<brave_shields::mojom::BraveShieldsHost>
       receivers_;
 
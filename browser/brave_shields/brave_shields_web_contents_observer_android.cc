@@ -15,9 +15,8 @@ using content::WebContents;
 
 namespace brave_shields {
 // static
-void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
-    const std::string& block_type,
-    const std::string& subresource,
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedEvents& blocked_events,
     WebContents* web_contents) {
   if (!web_contents) {
     return;
@@ -29,8 +28,10 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
   if (tab) {
     tabId = tab->GetAndroidId();
   }
-  chrome::android::BraveShieldsContentSettings::DispatchBlockedEvent(
-      tabId, block_type, subresource);
+  for (const auto& [block_type, subresource] : blocked_events) {
+    chrome::android::BraveShieldsContentSettings::DispatchBlockedEvent(
+        tabId, block_type, subresource);
+  }
 }
 
 }  // namespace brave_shields
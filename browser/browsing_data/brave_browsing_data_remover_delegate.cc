@@ -9,6 +9,8 @@
 #include <utility>
 
 #include "brave/browser/brave_news/brave_news_controller_factory.h"
+#include "brave/browser/brave_wallet/json_rpc_service_factory.h"
+#include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_today/browser/brave_news_controller.h"
 #include "brave/components/brave_today/common/features.h"
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
@@ -66,6 +68,17 @@ void BraveBrowsingDataRemoverDelegate::RemoveEmbedderData(
   if (remove_mask & content::BrowsingDataRemover::DATA_TYPE_CACHE)
     ClearIPFSCache();
 #endif
+
+  // Cached ENS, SNS and Unstoppable Domains resolutions tell which of those
+  // sites were visited.
+  if (remove_mask & (chrome_browsing_data_remover::DATA_TYPE_HISTORY |
+                     content::BrowsingDataRemover::DATA_TYPE_CACHE)) {
+    if (auto* json_rpc_service =
+            brave_wallet::JsonRpcServiceFactory::GetServiceForContext(
+                profile_)) {
+      json_rpc_service->ClearDecentralizedDnsResolveCaches();
+    }
+  }
   if (base::FeatureList::IsEnabled(brave_today::features::kBraveNewsFeature)) {
     // Brave News feed cache
     if (remove_mask & chrome_browsing_data_remover::DATA_TYPE_HISTORY) {
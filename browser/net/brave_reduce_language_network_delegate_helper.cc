@@ -73,8 +73,12 @@ int OnBeforeStartTransaction_ReduceLanguageWork(
   HostContentSettingsMap* content_settings =
       HostContentSettingsMapFactory::GetForProfile(profile);
   DCHECK(content_settings);
-  if (!brave_shields::ShouldDoReduceLanguage(content_settings, ctx->tab_origin,
-                                             profile->GetPrefs())) {
+  // Same checks as brave_shields::ShouldDoReduceLanguage(), but on the
+  // settings already resolved for this request.
+  if (!brave_shields::IsReduceLanguageEnabledForProfile(profile->GetPrefs()) ||
+      !ctx->shields_settings.shields_enabled ||
+      ctx->shields_settings.fingerprinting_control_type ==
+          ControlType::ALLOW) {
     return net::OK;
   }
   base::StringPiece tab_origin_host(ctx->tab_origin.host_piece());
@@ -82,8 +86,7 @@ int OnBeforeStartTransaction_ReduceLanguageWork(
     return net::OK;
 
   std::string accept_language_string;
-  switch (brave_shields::GetFingerprintingControlType(content_settings,
-                                                      ctx->tab_origin)) {
+  switch (ctx->shields_settings.fingerprinting_control_type) {
     case ControlType::BLOCK: {
       // If fingerprint blocking is maximum, set Accept-Language header to
       // static value regardless of other preferences.
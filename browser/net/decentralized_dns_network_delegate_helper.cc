@@ -27,6 +27,8 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK(!next_callback.is_null());
 
+  // Off-the-record profiles share JsonRpcService, and so its resolve caches,
+  // with their regular profile. Their lookups must not end up there.
   if (!ctx->browser_context || ctx->browser_context->IsOffTheRecord() ||
       !g_browser_process) {
     return net::OK;
@@ -17,6 +17,7 @@
 #include "brave/components/brave_wallet/browser/json_rpc_service_test_utils.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/eth_abi_utils.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/decentralized_dns/core/constants.h"
 #include "brave/components/decentralized_dns/core/pref_names.h"
@@ -97,13 +98,15 @@ TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
                             static_cast<int>(ResolveMethodTypes::ENABLED));
   EXPECT_TRUE(IsUnstoppableDomainsResolveMethodEnabled(local_state()));
 
-  // No redirect for OTR context.
+  // No redirect for OTR context, and no lookup which could be cached for the
+  // regular profile.
   brave_request_info->browser_context =
       profile()->GetPrimaryOTRProfile(/*create_if_needed=*/true);
   rc = OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(base::DoNothing(),
                                                           brave_request_info);
   EXPECT_EQ(rc, net::OK);
   EXPECT_TRUE(brave_request_info->new_url_spec.empty());
+  EXPECT_EQ(test_url_loader_factory().NumPending(), 0);
   brave_request_info->browser_context = profile();
 
   // TLD is not .crypto
@@ -171,6 +174,10 @@ TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
 
 TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
        UnstoppableDomainsRedirectWork) {
+  // Each navigation below resolves the same host with different responses.
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndDisableFeature(
+      brave_wallet::features::kBraveWalletDecentralizedDnsCacheFeature);
   local_state()->SetInteger(kUnstoppableDomainsResolveMethod,
                             static_cast<int>(ResolveMethodTypes::ENABLED));
 
@@ -236,6 +243,47 @@ TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
   EXPECT_EQ(brave_request_info->new_url_spec, "ipfs://hash");
 }
 
+TEST_F(DecentralizedDnsNetworkDelegateHelperTest,
+       UnstoppableDomainsRedirectWork_Cached) {
+  local_state()->SetInteger(kUnstoppableDomainsResolveMethod,
+                            static_cast<int>(ResolveMethodTypes::ENABLED));
+
+  GURL url("http://brave.crypto");
+  auto polygon_spec = brave_wallet::GetUnstoppableDomainsRpcUrl(
+                          brave_wallet::mojom::kPolygonMainnetChainId)
+                          .spec();
+  auto eth_spec = brave_wallet::GetUnstoppableDomainsRpcUrl(
+                      brave_wallet::mojom::kMainnetChainId)
+                      .spec();
+
+  auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  EXPECT_EQ(net::ERR_IO_PENDING,
+            OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+                base::DoNothing(), brave_request_info));
+  test_url_loader_factory().SimulateResponseForPendingRequest(
+      polygon_spec,
+      brave_wallet::MakeJsonRpcStringArrayResponse(
+          {"", "", "", "", "", "https://brave.com"}),
+      net::HTTP_OK);
+  test_url_loader_factory().SimulateResponseForPendingRequest(
+      eth_spec,
+      brave_wallet::MakeJsonRpcStringArrayResponse({"", "", "", "", "", ""}),
+      net::HTTP_OK);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(brave_request_info->new_url_spec, "https://brave.com/");
+
+  // The next navigation is resolved without any RPC request.
+  brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  brave_request_info->browser_context = profile();
+  EXPECT_EQ(net::ERR_IO_PENDING,
+            OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
+                base::DoNothing(), brave_request_info));
+  EXPECT_EQ(0, test_url_loader_factory().NumPending());
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(brave_request_info->new_url_spec, "https://brave.com/");
+}
+
 TEST_F(DecentralizedDnsNetworkDelegateHelperTest, EnsRedirectWork) {
   GURL url("http://brantly.eth");
   auto brave_request_info = std::make_shared<brave::BraveRequestInfo>(url);
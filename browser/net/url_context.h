@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
@@ -76,6 +77,9 @@ struct BraveRequestInfo {
 
   absl::optional<int> pending_error;
   std::string new_url_spec;
+  // Shields settings of |tab_origin|, resolved once per request. The flags
+  // below are derived from it.
+  brave_shields::ShieldsSettingsSnapshot shields_settings;
   // TODO(iefremov): rename to shields_up.
   bool allow_brave_shields = true;
   bool allow_ads = false;
@@ -0,0 +1,141 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/playlist/playlist_database.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "brave/components/playlist/playlist_constants.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace playlist {
+
+namespace {
+
+base::Value::Dict CreatePlaylistValue(const std::string& id,
+                                      const std::vector<std::string>& items) {
+  base::Value::List item_ids;
+  for (const auto& item : items)
+    item_ids.Append(item);
+
+  base::Value::Dict playlist;
+  playlist.Set(kPlaylistIDKey, id);
+  playlist.Set(kPlaylistNameKey, "name of " + id);
+  playlist.Set(kPlaylistItemsKey, std::move(item_ids));
+  return playlist;
+}
+
+base::Value::Dict CreateItemValue(const std::string& id) {
+  base::Value::Dict item;
+  item.Set(kPlaylistItemIDKey, id);
+  item.Set(kPlaylistItemTitleKey, "title of " + id);
+  return item;
+}
+
+std::vector<std::string> GetItemIds(
+    const std::vector<base::Value::Dict>& items) {
+  std::vector<std::string> ids;
+  for (const auto& item : items)
+    ids.push_back(*item.FindString(kPlaylistItemIDKey));
+  return ids;
+}
+
+}  // namespace
+
+class PlaylistDatabaseTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  std::unique_ptr<PlaylistDatabase> OpenDatabase(
+      base::Value::Dict legacy_playlists = {},
+      base::Value::Dict legacy_items = {}) {
+    auto database = std::make_unique<PlaylistDatabase>(
+        temp_dir_.GetPath().AppendASCII("playlist").AppendASCII("playlist.db"));
+    EXPECT_TRUE(
+        database->Init(std::move(legacy_playlists), std::move(legacy_items)));
+    return database;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(PlaylistDatabaseTest, ImportsPrefsOnce) {
+  base::Value::Dict playlists;
+  playlists.Set("list1", CreatePlaylistValue("list1", {"b", "a"}));
+  base::Value::Dict items;
+  items.Set("a", CreateItemValue("a"));
+  items.Set("b", CreateItemValue("b"));
+
+  auto database = OpenDatabase(playlists.Clone(), items.Clone());
+  auto contents = database->Load();
+  EXPECT_EQ(playlists, contents.playlists);
+  EXPECT_EQ(items, contents.items);
+
+  // Prefs are only imported into a new database.
+  database.reset();
+  base::Value::Dict other_playlists;
+  other_playlists.Set("list2", CreatePlaylistValue("list2", {}));
+  database = OpenDatabase(std::move(other_playlists));
+  contents = database->Load();
+  EXPECT_EQ(playlists, contents.playlists);
+  EXPECT_EQ(items, contents.items);
+}
+
+TEST_F(PlaylistDatabaseTest, SetAndDelete) {
+  auto database = OpenDatabase();
+  EXPECT_TRUE(database->SetPlaylist(CreatePlaylistValue("list1", {"a", "b"})));
+  EXPECT_TRUE(database->SetPlaylist(CreatePlaylistValue("list2", {"c"})));
+  EXPECT_TRUE(database->SetItem("a", CreateItemValue("a")));
+  EXPECT_TRUE(database->SetItem("b", CreateItemValue("b")));
+  EXPECT_TRUE(database->SetItem("c", CreateItemValue("c")));
+
+  // Reordering a playlist rewrites its order only.
+  EXPECT_TRUE(database->SetPlaylist(CreatePlaylistValue("list1", {"b", "a"})));
+  auto contents = database->Load();
+  EXPECT_EQ(CreatePlaylistValue("list1", {"b", "a"}),
+            *contents.playlists.FindDict("list1"));
+  EXPECT_EQ(CreatePlaylistValue("list2", {"c"}),
+            *contents.playlists.FindDict("list2"));
+
+  EXPECT_TRUE(database->DeletePlaylist("list2"));
+  EXPECT_TRUE(database->DeleteItem("c"));
+  contents = database->Load();
+  EXPECT_FALSE(contents.playlists.contains("list2"));
+  EXPECT_FALSE(contents.items.contains("c"));
+  EXPECT_EQ(2u, contents.items.size());
+
+  EXPECT_TRUE(database->DeleteAllItems());
+  contents = database->Load();
+  EXPECT_TRUE(contents.items.empty());
+  EXPECT_EQ(1u, contents.playlists.size());
+
+  EXPECT_TRUE(database->DeleteAll());
+  contents = database->Load();
+  EXPECT_TRUE(contents.playlists.empty());
+}
+
+TEST_F(PlaylistDatabaseTest, GetPlaylistItems) {
+  auto database = OpenDatabase();
+  std::vector<std::string> ids = {"e", "d", "c", "b", "a"};
+  EXPECT_TRUE(database->SetPlaylist(CreatePlaylistValue("list1", ids)));
+  for (const auto& id : ids)
+    EXPECT_TRUE(database->SetItem(id, CreateItemValue(id)));
+
+  EXPECT_EQ(std::vector<std::string>({"e", "d"}),
+            GetItemIds(database->GetPlaylistItems("list1", 0, 2)));
+  EXPECT_EQ(std::vector<std::string>({"c", "b"}),
+            GetItemIds(database->GetPlaylistItems("list1", 2, 2)));
+  EXPECT_EQ(std::vector<std::string>({"a"}),
+            GetItemIds(database->GetPlaylistItems("list1", 4, 2)));
+  EXPECT_TRUE(database->GetPlaylistItems("list1", 5, 2).empty());
+  EXPECT_TRUE(database->GetPlaylistItems("list2", 0, 2).empty());
+}
+
+}  // namespace playlist
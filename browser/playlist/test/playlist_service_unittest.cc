@@ -5,16 +5,23 @@
 
 #include "brave/components/playlist/playlist_service.h"
 
+#include <string>
+#include <vector>
+
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/run_loop.h"
+#include "base/strings/string_util.h"
+#include "base/synchronization/lock.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
+#include "base/thread_annotations.h"
 #include "base/timer/timer.h"
 #include "brave/browser/playlist/playlist_service_factory.h"
 #include "brave/components/playlist/features.h"
 #include "brave/components/playlist/media_detector_component_manager.h"
 #include "brave/components/playlist/playlist_constants.h"
+#include "brave/components/playlist/playlist_media_file_download_manager.h"
 #include "brave/components/playlist/playlist_service_helper.h"
 #include "brave/components/playlist/playlist_service_observer.h"
 #include "brave/components/playlist/pref_names.h"
@@ -44,11 +51,27 @@ std::unique_ptr<net::test_server::HttpResponse> HandleRequest(
     const net::test_server::HttpRequest& request) {
   auto http_response = std::make_unique<net::test_server::BasicHttpResponse>();
   if (request.relative_url == "/valid_thumbnail" ||
-      request.relative_url == "/valid_media_file_1" ||
-      request.relative_url == "/valid_media_file_2") {
+      base::StartsWith(request.relative_url, "/valid_media_file_")) {
     http_response->set_code(net::HTTP_OK);
     http_response->set_content_type("image/gif");
     http_response->set_content("thumbnail");
+  } else if (request.relative_url == "/resumable_media_file") {
+    // Serves "media_file_content", or its tail for range requests.
+    http_response->AddCustomHeader("ETag", "\"media\"");
+    http_response->AddCustomHeader("Accept-Ranges", "bytes");
+    http_response->set_content_type("video/mp4");
+    auto range = request.headers.find("Range");
+    if (range != request.headers.end() && range->second == "bytes=6-") {
+      http_response->set_code(net::HTTP_PARTIAL_CONTENT);
+      http_response->AddCustomHeader("Content-Range", "bytes 6-17/18");
+      http_response->set_content("file_content");
+    } else {
+      http_response->set_code(net::HTTP_OK);
+      http_response->set_content("media_file_content");
+    }
+  } else if (request.relative_url == "/hung_media_file") {
+    // Keeps a downloader busy until its download is cancelled.
+    return std::make_unique<net::test_server::HungResponse>();
   } else {
     http_response->set_code(net::HTTP_NOT_FOUND);
   }
@@ -99,6 +122,20 @@ class PlaylistServiceUnitTest : public testing::Test {
 
   PrefService* prefs() { return profile_->GetPrefs(); }
 
+  // Media file requests the test server has received, in order.
+  std::vector<std::string> GetMediaFileRequests() {
+    base::AutoLock lock(media_file_requests_lock_);
+    return media_file_requests_;
+  }
+
+  PlaylistItemInfo GetMediaFileItemInfo(const std::string& relative_url) {
+    auto params = GetValidCreateParams();
+    params.id = base::Token::CreateRandom().ToString();
+    params.media_src = params.media_file_path =
+        https_server()->GetURL(relative_url).spec();
+    return params;
+  }
+
   void WaitUntil(base::RepeatingCallback<bool()> condition) {
     if (condition.Run())
       return;
@@ -128,6 +165,38 @@ class PlaylistServiceUnitTest : public testing::Test {
     return params;
   }
 
+  PlaylistItemInfo GetItemInfo(const std::string& id) {
+    PlaylistItemInfo info;
+    info.id = id;
+    info.page_src = "https://foo.com/";
+    info.title = id;
+    info.thumbnail_src = info.thumbnail_path = "https://thumbnail.src/";
+    info.media_src = info.media_file_path = "https://media.src/";
+    return info;
+  }
+
+  // Item ids of |playlist_id|, read through the public getter.
+  base::flat_set<std::string> GetPlaylistItemIds(
+      const std::string& playlist_id) {
+    base::flat_set<std::string> ids;
+    auto playlist = service_->GetPlaylist(playlist_id);
+    if (!playlist)
+      return ids;
+    for (const auto& item : playlist->items)
+      ids.insert(item.id);
+    return ids;
+  }
+
+  // Creates a new service for the same profile. It hasn't loaded playlists
+  // yet when this returns.
+  void RecreatePlaylistService() {
+    service_.reset();
+    // Lets the database close before it's opened again.
+    task_environment_.RunUntilIdle();
+    service_ = std::make_unique<playlist::PlaylistService>(
+        profile_.get(), detector_manager_.get());
+  }
+
   PlaylistItemInfo GetValidCreateParamsForIncompleteMediaFileList() {
     PlaylistItemInfo params;
     params.title = "Valid playlist creation params";
@@ -187,17 +256,28 @@ class PlaylistServiceUnitTest : public testing::Test {
     detector_manager_->SetUseLocalScriptForTesting();
     service_ = std::make_unique<playlist::PlaylistService>(
         profile_.get(), detector_manager_.get());
+    WaitUntil(base::BindLambdaForTesting(
+        [&]() { return service_->is_ready(); }));
 
     // Set up embedded test server to handle fake responses.
     https_server_ = std::make_unique<net::EmbeddedTestServer>(
         net::test_server::EmbeddedTestServer::TYPE_HTTP);
     https_server_->RegisterRequestHandler(base::BindRepeating(&HandleRequest));
+    https_server_->RegisterRequestMonitor(base::BindLambdaForTesting(
+        [this](const net::test_server::HttpRequest& request) {
+          if (request.relative_url == "/valid_thumbnail")
+            return;
+          base::AutoLock lock(media_file_requests_lock_);
+          media_file_requests_.push_back(request.relative_url);
+        }));
     ASSERT_TRUE(https_server_->Start());
   }
 
   void TearDown() override {
     https_server_.reset();
     service_.reset();
+    // Lets the database close before its directory is deleted.
+    task_environment_.RunUntilIdle();
     detector_manager_.reset();
     profile_.reset();
     temp_dir_.reset();
@@ -222,6 +302,10 @@ class PlaylistServiceUnitTest : public testing::Test {
 
   std::unique_ptr<net::EmbeddedTestServer> https_server_;
   std::unique_ptr<content::TestHostResolver> host_resolver_;
+
+  base::Lock media_file_requests_lock_;
+  std::vector<std::string> media_file_requests_
+      GUARDED_BY(media_file_requests_lock_);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -644,30 +728,24 @@ TEST_F(PlaylistServiceUnitTest, AddItemsToList) {
   auto* service = playlist_service();
 
   // Precondition - Default playlist exists and its items should be empty.
-  auto* prefs = this->prefs();
-  auto* default_playlist = prefs->GetDict(playlist::kPlaylistsPref)
-                               .FindDict(playlist::kDefaultPlaylistID);
-  ASSERT_TRUE(default_playlist);
-  auto* items = default_playlist->FindList(playlist::kPlaylistItemsKey);
-  ASSERT_TRUE(items);
-  ASSERT_TRUE(items->empty());
+  // The items exist in another playlist.
+  ASSERT_TRUE(service->GetPlaylist(playlist::kDefaultPlaylistID));
+  ASSERT_TRUE(GetPlaylistItemIds(playlist::kDefaultPlaylistID).empty());
+
+  playlist::PlaylistInfo another_playlist;
+  service->CreatePlaylist(another_playlist);
+  const base::flat_set<std::string> item_ids = {"id1", "id2", "id3"};
+  service->AddMediaFilesFromItems(
+      another_playlist.id, /* cache= */ false,
+      {GetItemInfo("id1"), GetItemInfo("id2"), GetItemInfo("id3")});
+  ASSERT_EQ(item_ids, GetPlaylistItemIds(another_playlist.id));
 
   // Try adding items and check they're stored well.
   // Adding duplicate items should affect the list, but considered as success.
-  const base::flat_set<std::string> item_ids = {"id1", "id2", "id3"};
   for (int i = 0; i < 2; i++) {
     EXPECT_TRUE(service->AddItemsToPlaylist(
         playlist::kDefaultPlaylistID, {item_ids.begin(), item_ids.end()}));
-    default_playlist = prefs->GetDict(playlist::kPlaylistsPref)
-                           .FindDict(playlist::kDefaultPlaylistID);
-    EXPECT_TRUE(default_playlist);
-
-    items = default_playlist->FindList(playlist::kPlaylistItemsKey);
-    EXPECT_TRUE(items);
-    base::flat_set<std::string> stored_ids;
-    base::ranges::transform(*items, std::inserter(stored_ids, stored_ids.end()),
-                            [](const auto& item) { return item.GetString(); });
-    EXPECT_EQ(item_ids, stored_ids);
+    EXPECT_EQ(item_ids, GetPlaylistItemIds(playlist::kDefaultPlaylistID));
   }
 
   // Try adding items to a non-existing playlist and it should fail.
@@ -683,23 +761,15 @@ TEST_F(PlaylistServiceUnitTest, MoveItem) {
   // Precondition - Default playlist exists and it has some items. And there's
   // another playlist which is empty.
   base::flat_set<std::string> item_ids = {"id1", "id2", "id3"};
-  EXPECT_TRUE(service->AddItemsToPlaylist(playlist::kDefaultPlaylistID,
-                                          {item_ids.begin(), item_ids.end()}));
-  auto* prefs = this->prefs();
-  auto* playlist_value = prefs->GetDict(playlist::kPlaylistsPref)
-                             .FindDict(playlist::kDefaultPlaylistID);
-  ASSERT_TRUE(playlist_value);
-  auto* items = playlist_value->FindList(playlist::kPlaylistItemsKey);
-  ASSERT_EQ(item_ids.size(), items->size());
+  service->AddMediaFilesFromItems(
+      playlist::kDefaultPlaylistID, /* cache= */ false,
+      {GetItemInfo("id1"), GetItemInfo("id2"), GetItemInfo("id3")});
+  ASSERT_EQ(item_ids, GetPlaylistItemIds(playlist::kDefaultPlaylistID));
 
   playlist::PlaylistInfo another_playlist;
   service->CreatePlaylist(another_playlist);
-
-  playlist_value =
-      prefs->GetDict(playlist::kPlaylistsPref).FindDict(another_playlist.id);
-  ASSERT_TRUE(playlist_value);
-  items = playlist_value->FindList(playlist::kPlaylistItemsKey);
-  ASSERT_TRUE(items->empty());
+  ASSERT_TRUE(service->GetPlaylist(another_playlist.id));
+  ASSERT_TRUE(GetPlaylistItemIds(another_playlist.id).empty());
 
   // Try moving all items from default list to another playlist.
   for (const auto& id : item_ids) {
@@ -707,17 +777,8 @@ TEST_F(PlaylistServiceUnitTest, MoveItem) {
                                   PlaylistId(another_playlist.id),
                                   PlaylistItemId(id)));
   }
-  playlist_value =
-      prefs->GetDict(playlist::kPlaylistsPref).FindDict(another_playlist.id);
-  EXPECT_TRUE(playlist_value);
-  items = playlist_value->FindList(playlist::kPlaylistItemsKey);
-  base::flat_set<std::string> stored_ids;
-  base::ranges::transform(*items, std::inserter(stored_ids, stored_ids.end()),
-                          [](const auto& item) { return item.GetString(); });
-  EXPECT_EQ(item_ids, stored_ids);
-  playlist_value = prefs->GetDict(playlist::kPlaylistsPref)
-                       .FindDict(playlist::kDefaultPlaylistID);
-  EXPECT_TRUE(playlist_value->FindList(playlist::kPlaylistItemsKey)->empty());
+  EXPECT_EQ(item_ids, GetPlaylistItemIds(another_playlist.id));
+  EXPECT_TRUE(GetPlaylistItemIds(playlist::kDefaultPlaylistID).empty());
 
   // Try moving items to non-existing playlist. Then it should fail and the
   // original playlist should be unchanged.
@@ -726,14 +787,67 @@ TEST_F(PlaylistServiceUnitTest, MoveItem) {
                                    PlaylistId("non-existing-id"),
                                    PlaylistItemId(id)));
   }
-  playlist_value =
-      prefs->GetDict(playlist::kPlaylistsPref).FindDict(another_playlist.id);
-  EXPECT_TRUE(playlist_value);
-  items = playlist_value->FindList(playlist::kPlaylistItemsKey);
-  stored_ids.clear();
-  base::ranges::transform(*items, std::inserter(stored_ids, stored_ids.end()),
-                          [](const auto& item) { return item.GetString(); });
-  EXPECT_EQ(item_ids, stored_ids);
+  EXPECT_EQ(item_ids, GetPlaylistItemIds(another_playlist.id));
+}
+
+TEST_F(PlaylistServiceUnitTest, KeepsDefaultPlaylistItemsAcrossRestarts) {
+  auto* service = playlist_service();
+  service->AddMediaFilesFromItems(
+      playlist::kDefaultPlaylistID, /* cache= */ false,
+      {GetItemInfo("id1"), GetItemInfo("id2")});
+  const base::flat_set<std::string> expected_ids = {"id1", "id2"};
+  ASSERT_EQ(expected_ids, GetPlaylistItemIds(playlist::kDefaultPlaylistID));
+
+  // Restart twice, as the first restart is the one that clears the prefs.
+  for (int i = 0; i < 2; i++) {
+    RecreatePlaylistService();
+    service = playlist_service();
+    WaitUntil(
+        base::BindLambdaForTesting([&]() { return service->is_ready(); }));
+    EXPECT_EQ(expected_ids, GetPlaylistItemIds(playlist::kDefaultPlaylistID));
+  }
+}
+
+TEST_F(PlaylistServiceUnitTest, ChangeItemsBeforeLoaded) {
+  using PlaylistId = playlist::PlaylistService::PlaylistId;
+  using PlaylistItemId = playlist::PlaylistService::PlaylistItemId;
+
+  // Precondition - Default playlist has some items and there's another
+  // playlist which is empty.
+  auto* service = playlist_service();
+  service->AddMediaFilesFromItems(
+      playlist::kDefaultPlaylistID, /* cache= */ false,
+      {GetItemInfo("id1"), GetItemInfo("id2"), GetItemInfo("id3")});
+  playlist::PlaylistInfo another_playlist;
+  service->CreatePlaylist(another_playlist);
+
+  RecreatePlaylistService();
+  service = playlist_service();
+  ASSERT_FALSE(service->is_ready());
+
+  // Changes made before loading finishes are applied once it does.
+  EXPECT_TRUE(service->MoveItem(PlaylistId(playlist::kDefaultPlaylistID),
+                                PlaylistId(another_playlist.id),
+                                PlaylistItemId("id1")));
+  EXPECT_TRUE(service->RemoveItemFromPlaylist(
+      PlaylistId(playlist::kDefaultPlaylistID), PlaylistItemId("id2"),
+      /* remove_item = */ false));
+  EXPECT_TRUE(service->AddItemsToPlaylist(another_playlist.id, {"id2"}));
+
+  WaitUntil(base::BindLambdaForTesting([&]() { return service->is_ready(); }));
+  const base::flat_set<std::string> expected_default_ids = {"id3"};
+  const base::flat_set<std::string> expected_another_ids = {"id1", "id2"};
+  EXPECT_EQ(expected_default_ids,
+            GetPlaylistItemIds(playlist::kDefaultPlaylistID));
+  EXPECT_EQ(expected_another_ids, GetPlaylistItemIds(another_playlist.id));
+
+  // And they're stored.
+  RecreatePlaylistService();
+  service = playlist_service();
+  WaitUntil(base::BindLambdaForTesting([&]() { return service->is_ready(); }));
+  EXPECT_EQ(expected_default_ids,
+            GetPlaylistItemIds(playlist::kDefaultPlaylistID));
+  EXPECT_EQ(expected_another_ids, GetPlaylistItemIds(another_playlist.id));
 }
 
 TEST_F(PlaylistServiceUnitTest, CachingBehavior) {
@@ -815,7 +929,9 @@ TEST_F(PlaylistServiceUnitTest, UpdateItem) {
       {info});
 
   WaitUntil(base::BindLambdaForTesting([&]() {
-    return !!prefs()->GetDict(kPlaylistItemsPref).FindDict(info.id);
+    return base::ranges::any_of(
+        playlist_service()->GetAllPlaylistItems(),
+        [&info](const auto& item) { return item.id == info.id; });
   }));
 
   testing::NiceMock<MockObserver> observer;
@@ -835,4 +951,188 @@ TEST_F(PlaylistServiceUnitTest, UpdateItem) {
   playlist_service()->RemoveObserver(&observer);
 }
 
+TEST_F(PlaylistServiceUnitTest, DownloadsMediaFilesConcurrently) {
+  auto* service = playlist_service();
+
+  std::vector<PlaylistItemInfo> items;
+  for (size_t i = 0;
+       i < PlaylistMediaFileDownloadManager::kMaxConcurrentDownloads * 2; i++) {
+    auto params = GetValidCreateParams();
+    params.id = base::Token::CreateRandom().ToString();
+    items.push_back(params);
+  }
+
+  size_t cached_count = 0;
+  testing::NiceMock<MockObserver> observer;
+  ON_CALL(observer, OnPlaylistStatusChanged(testing::_))
+      .WillByDefault([&](const PlaylistChangeParams& params) {
+        if (params.change_type == PlaylistChangeParams::Type::kItemCached)
+          cached_count++;
+      });
+  service->AddObserver(&observer);
+
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true, items);
+  WaitUntil(base::BindLambdaForTesting(
+      [&]() { return cached_count == items.size(); }));
+
+  for (const auto& item : items)
+    EXPECT_TRUE(service->GetPlaylistItem(item.id).media_file_cached);
+
+  service->RemoveObserver(&observer);
+}
+
+TEST_F(PlaylistServiceUnitTest, ResumesMediaFileDownload) {
+  auto* service = playlist_service();
+
+  auto params = GetValidCreateParams();
+  params.id = base::Token::CreateRandom().ToString();
+  params.media_src = params.media_file_path =
+      https_server()->GetURL("/resumable_media_file").spec();
+
+  // A previous attempt was interrupted after the first six bytes.
+  const base::FilePath media_file =
+      service->GetPlaylistItemDirPath(params.id)
+          .Append(PlaylistMediaFileDownloadManager::kMediaFileName);
+  {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    ASSERT_TRUE(base::CreateDirectory(media_file.DirName()));
+    ASSERT_TRUE(base::WriteFile(media_file, "MEDIA_"));
+    ASSERT_TRUE(base::WriteFile(
+        media_file.AddExtension(FILE_PATH_LITERAL("resume")),
+        R"({"etag": "\"media\"", "last_modified": ""})"));
+  }
+
+  bool cached = false;
+  testing::NiceMock<MockObserver> observer;
+  EXPECT_CALL(observer,
+              OnPlaylistStatusChanged(PlaylistChangeParams(
+                  PlaylistChangeParams::Type::kItemCached, params.id)))
+      .WillOnce([&]() { cached = true; });
+  service->AddObserver(&observer);
+
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true, {params});
+  WaitUntil(base::BindLambdaForTesting([&]() { return cached; }));
+
+  // Only the missing range was requested and appended to the partial file.
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(media_file, &contents));
+  EXPECT_EQ("MEDIA_file_content", contents);
+
+  service->RemoveObserver(&observer);
+}
+
+TEST_F(PlaylistServiceUnitTest, DownloadsPendingMediaFilesInPlaylistOrder) {
+  using PlaylistId = playlist::PlaylistService::PlaylistId;
+  using PlaylistItemId = playlist::PlaylistService::PlaylistItemId;
+
+  auto* service = playlist_service();
+
+  // Keep all downloaders busy.
+  std::vector<PlaylistItemInfo> hung_items;
+  for (size_t i = 0;
+       i < PlaylistMediaFileDownloadManager::kMaxConcurrentDownloads; i++) {
+    hung_items.push_back(GetMediaFileItemInfo("/hung_media_file"));
+  }
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true,
+                                  hung_items);
+  WaitUntil(base::BindLambdaForTesting(
+      [&]() { return GetMediaFileRequests().size() == hung_items.size(); }));
+
+  std::vector<PlaylistItemInfo> items = {
+      GetMediaFileItemInfo("/valid_media_file_a"),
+      GetMediaFileItemInfo("/valid_media_file_b"),
+      GetMediaFileItemInfo("/valid_media_file_c")};
+
+  // Thumbnails are requested along with the media files, so once they are
+  // ready, all media files are waiting for a downloader.
+  size_t thumbnail_ready_count = 0;
+  testing::NiceMock<MockObserver> observer;
+  ON_CALL(observer, OnPlaylistStatusChanged(testing::_))
+      .WillByDefault([&](const PlaylistChangeParams& params) {
+        if (params.change_type ==
+                PlaylistChangeParams::Type::kItemThumbnailReady &&
+            base::ranges::any_of(items, [&params](const auto& item) {
+              return item.id == params.playlist_id;
+            })) {
+          thumbnail_ready_count++;
+        }
+      });
+  service->AddObserver(&observer);
+
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true, items);
+  WaitUntil(base::BindLambdaForTesting(
+      [&]() { return thumbnail_ready_count == items.size(); }));
+
+  // Move "a" to the end of the playlist while it's waiting.
+  ASSERT_TRUE(service->MoveItem(PlaylistId(playlist::kDefaultPlaylistID),
+                                PlaylistId(playlist::kDefaultPlaylistID),
+                                PlaylistItemId(items[0].id)));
+
+  // Each cancelled download frees a downloader for the next item.
+  for (size_t i = 0; i < hung_items.size(); i++) {
+    service->DeletePlaylistItemData(hung_items[i].id);
+    WaitUntil(base::BindLambdaForTesting([&]() {
+      return GetMediaFileRequests().size() == hung_items.size() + i + 1;
+    }));
+  }
+
+  EXPECT_THAT(
+      GetMediaFileRequests(),
+      testing::ElementsAre("/hung_media_file", "/hung_media_file",
+                           "/hung_media_file", "/valid_media_file_b",
+                           "/valid_media_file_c", "/valid_media_file_a"));
+
+  service->RemoveObserver(&observer);
+}
+
+TEST_F(PlaylistServiceUnitTest, CancelsMediaFileDownloadInFlight) {
+  auto* service = playlist_service();
+
+  std::vector<PlaylistItemInfo> hung_items;
+  for (size_t i = 0;
+       i < PlaylistMediaFileDownloadManager::kMaxConcurrentDownloads; i++) {
+    hung_items.push_back(GetMediaFileItemInfo("/hung_media_file"));
+  }
+  const auto cancelled_id = hung_items[0].id;
+
+  bool cached = false;
+  auto params = GetMediaFileItemInfo("/valid_media_file_1");
+  testing::NiceMock<MockObserver> observer;
+  EXPECT_CALL(observer,
+              OnPlaylistStatusChanged(PlaylistChangeParams(
+                  PlaylistChangeParams::Type::kItemCached, params.id)))
+      .WillOnce([&]() { cached = true; });
+  EXPECT_CALL(observer,
+              OnPlaylistStatusChanged(PlaylistChangeParams(
+                  PlaylistChangeParams::Type::kItemCached, cancelled_id)))
+      .Times(0);
+  EXPECT_CALL(observer,
+              OnPlaylistStatusChanged(PlaylistChangeParams(
+                  PlaylistChangeParams::Type::kItemAborted, cancelled_id)))
+      .Times(0);
+  service->AddObserver(&observer);
+
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true,
+                                  hung_items);
+  WaitUntil(base::BindLambdaForTesting(
+      [&]() { return GetMediaFileRequests().size() == hung_items.size(); }));
+
+  // All downloaders are busy, so this one waits.
+  service->AddMediaFilesFromItems(std::string(), /* cache= */ true, {params});
+  service->DeletePlaylistItemData(cancelled_id);
+  WaitUntil(base::BindLambdaForTesting([&]() { return cached; }));
+
+  EXPECT_TRUE(service->GetPlaylistItem(params.id).media_file_cached);
+
+  // Nothing of the cancelled download is left behind.
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    base::ScopedAllowBlockingForTesting allow_blocking;
+    return !base::DirectoryExists(
+        service->GetPlaylistItemDirPath(cancelled_id));
+  }));
+
+  service->RemoveObserver(&observer);
+}
+
 }  // namespace playlist
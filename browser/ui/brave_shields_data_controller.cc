@@ -7,6 +7,7 @@
 #include "brave/browser/ui/brave_shields_data_controller.h"
 
 #include <string>
+#include <utility>
 
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -355,23 +356,45 @@ bool BraveShieldsDataController::IsBraveShieldsManaged() {
       GetCurrentSiteURL());
 }
 
-void BraveShieldsDataController::HandleItemBlocked(
-    const std::string& block_type,
-    const std::string& subresource) {
-  auto subres = GURL(subresource);
+void BraveShieldsDataController::HandleItemsBlocked(
+    const std::vector<std::pair<std::string, std::string>>& blocked) {
+  mojom::BlockedResources added;
+  for (const auto& [block_type, subresource] : blocked) {
+    std::set<GURL>* resource_list = nullptr;
+    std::vector<GURL>* added_list = nullptr;
+    if (block_type == kAds) {
+      resource_list = &resource_list_blocked_ads_;
+      added_list = &added.ads_list;
+    } else if (block_type == kHTTPUpgradableResources) {
+      resource_list = &resource_list_http_redirects_;
+      added_list = &added.http_redirects_list;
+    } else if (block_type == kJavaScript) {
+      resource_list = &resource_list_blocked_js_;
+      added_list = &added.js_list;
+    } else if (block_type == kFingerprintingV2) {
+      resource_list = &resource_list_blocked_fingerprints_;
+      added_list = &added.fingerprints_list;
+    } else {
+      continue;
+    }
+
+    GURL subres(subresource);
+    if (resource_list->insert(subres).second)
+      added_list->push_back(std::move(subres));
+  }
 
-  if (block_type == kAds) {
-    resource_list_blocked_ads_.insert(subres);
-  } else if (block_type == kHTTPUpgradableResources) {
-    resource_list_http_redirects_.insert(subres);
-  } else if (block_type == kJavaScript) {
-    resource_list_blocked_js_.insert(subres);
-  } else if (block_type == kFingerprintingV2) {
-    resource_list_blocked_fingerprints_.insert(subres);
+  if (added.ads_list.empty() && added.http_redirects_list.empty() &&
+      added.js_list.empty() && added.fingerprints_list.empty()) {
+    return;
   }
 
   for (Observer& obs : observer_list_)
-    obs.OnResourcesChanged();
+    obs.OnResourcesAdded(added);
+}
+
+void BraveShieldsDataController::Observer::OnResourcesAdded(
+    const mojom::BlockedResources& added) {
+  OnResourcesChanged();
 }
 
 WEB_CONTENTS_USER_DATA_KEY_IMPL(BraveShieldsDataController);
@@ -8,6 +8,7 @@
 
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/observer_list.h"
@@ -43,12 +44,17 @@ class BraveShieldsDataController
   class Observer : public base::CheckedObserver {
    public:
     virtual void OnResourcesChanged() = 0;
+    // Called with the resources blocked since the last notification, instead
+    // of OnResourcesChanged(), while a page is loading.
+    virtual void OnResourcesAdded(const mojom::BlockedResources& added);
     virtual void OnFaviconUpdated() {}
     virtual void OnShieldsEnabledChanged() {}
   };
 
-  void HandleItemBlocked(const std::string& block_type,
-                         const std::string& subresource);
+  // Adds subresources blocked since the last call, paired with their block
+  // type, and notifies observers once about the ones that weren't listed yet.
+  void HandleItemsBlocked(
+      const std::vector<std::pair<std::string, std::string>>& blocked);
   void ClearAllResourcesList();
   int GetTotalBlockedCount();
   std::vector<GURL> GetBlockedAdsList();
@@ -4,6 +4,7 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <vector>
 
 #include "brave/browser/ui/brave_shields_data_controller.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -35,6 +36,10 @@ constexpr char kTestProfileName[] = "TestProfile";
 class MockObserver : public BraveShieldsDataController::Observer {
  public:
   MOCK_METHOD(void, OnResourcesChanged, (), (override));
+  MOCK_METHOD(void,
+              OnResourcesAdded,
+              (const brave_shields::mojom::BlockedResources&),
+              (override));
   MOCK_METHOD(void, OnShieldsEnabledChanged, (), (override));
 };
 }  // namespace
@@ -401,3 +406,46 @@ TEST_F(BraveShieldsDataControllerTest, SetBraveShieldsEnabledAsDefaultValue) {
                   ->GetDict("profile.content_settings.exceptions.braveShields")
                   .empty());
 }
+
+TEST_F(BraveShieldsDataControllerTest, HandleItemsBlockedNotifiesOnce) {
+  auto* controller = GetShieldsDataController();
+  MockObserver observer;
+  controller->AddObserver(&observer);
+
+  brave_shields::mojom::BlockedResourcesPtr added;
+  auto save_added =
+      [&added](const brave_shields::mojom::BlockedResources& resources) {
+        added = resources.Clone();
+      };
+  EXPECT_CALL(observer, OnResourcesAdded)
+      .WillOnce(save_added)
+      .RetiresOnSaturation();
+  // A resource blocked repeatedly is listed once.
+  controller->HandleItemsBlocked(
+      {{brave_shields::kAds, "https://a.com/ad.js"},
+       {brave_shields::kAds, "https://b.com/ad.js"},
+       {brave_shields::kJavaScript, "https://c.com/script.js"},
+       {brave_shields::kAds, "https://a.com/ad.js"}});
+  EXPECT_EQ(2u, added->ads_list.size());
+  EXPECT_EQ(1u, added->js_list.size());
+  EXPECT_EQ(3, controller->GetTotalBlockedCount());
+
+  // Only resources that weren't listed yet are reported.
+  EXPECT_CALL(observer, OnResourcesAdded)
+      .WillOnce(save_added)
+      .RetiresOnSaturation();
+  controller->HandleItemsBlocked(
+      {{brave_shields::kAds, "https://a.com/ad.js"},
+       {brave_shields::kAds, "https://d.com/ad.js"}});
+  EXPECT_EQ(std::vector<GURL>({GURL("https://d.com/ad.js")}),
+            added->ads_list);
+  EXPECT_TRUE(added->js_list.empty());
+  EXPECT_EQ(4, controller->GetTotalBlockedCount());
+
+  // Nothing new, so observers aren't notified.
+  EXPECT_CALL(observer, OnResourcesAdded).Times(0);
+  controller->HandleItemsBlocked(
+      {{brave_shields::kAds, "https://a.com/ad.js"}});
+
+  controller->RemoveObserver(&observer);
+}
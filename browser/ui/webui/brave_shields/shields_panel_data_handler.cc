@@ -177,6 +177,32 @@ void ShieldsPanelDataHandler::OnResourcesChanged() {
   UpdateSiteBlockInfo();
 }
 
+void ShieldsPanelDataHandler::OnResourcesAdded(
+    const brave_shields::mojom::BlockedResources& added) {
+  if (!active_shields_data_controller_)
+    return;
+
+  // Only the new resources are sent, rather than every list in full.
+  site_block_info_.total_blocked_resources =
+      active_shields_data_controller_->GetTotalBlockedCount();
+  site_block_info_.ads_list.insert(site_block_info_.ads_list.end(),
+                                   added.ads_list.begin(),
+                                   added.ads_list.end());
+  site_block_info_.http_redirects_list.insert(
+      site_block_info_.http_redirects_list.end(),
+      added.http_redirects_list.begin(), added.http_redirects_list.end());
+  site_block_info_.js_list.insert(site_block_info_.js_list.end(),
+                                  added.js_list.begin(), added.js_list.end());
+  site_block_info_.fingerprints_list.insert(
+      site_block_info_.fingerprints_list.end(), added.fingerprints_list.begin(),
+      added.fingerprints_list.end());
+
+  if (ui_handler_remote_) {
+    ui_handler_remote_.get()->OnBlockedResourcesAdded(
+        added.Clone(), site_block_info_.total_blocked_resources);
+  }
+}
+
 void ShieldsPanelDataHandler::OnFaviconUpdated() {
   UpdateFavicon();
 }
@@ -54,6 +54,8 @@ class ShieldsPanelDataHandler
 
   // BraveShieldsDataController::Observer
   void OnResourcesChanged() override;
+  void OnResourcesAdded(
+      const brave_shields::mojom::BlockedResources& added) override;
   void OnFaviconUpdated() override;
 
   // TabStripModelObserver
@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/json/values_util.h"
 #include "brave/browser/playlist/playlist_service_factory.h"
 #include "brave/components/playlist/playlist_constants.h"
@@ -73,6 +74,24 @@ void PlaylistPageHandler::GetPlaylist(
       playlist->id, playlist->name, std::move(items)));
 }
 
+void PlaylistPageHandler::GetPlaylistItems(
+    const std::string& playlist_id,
+    uint32_t offset,
+    uint32_t count,
+    PlaylistPageHandler::GetPlaylistItemsCallback callback) {
+  GetPlaylistService(profile_)->GetPlaylistItems(
+      playlist_id, offset, count,
+      base::BindOnce(
+          [](PlaylistPageHandler::GetPlaylistItemsCallback callback,
+             std::vector<playlist::PlaylistItemInfo> items) {
+            std::vector<mojo::StructPtr<playlist::mojom::PlaylistItem>> result;
+            for (const auto& item : items)
+              result.push_back(playlist::GetPlaylistItemMojoFromInfo(item));
+            std::move(callback).Run(std::move(result));
+          },
+          std::move(callback)));
+}
+
 void PlaylistPageHandler::AddMediaFilesFromPageToPlaylist(const std::string& id,
                                                           const GURL& url) {
   GetPlaylistService(profile_)->AddMediaFilesFromPageToPlaylist(
@@ -34,6 +34,11 @@ class PlaylistPageHandler : public playlist::mojom::PageHandler,
       PlaylistPageHandler::GetAllPlaylistsCallback callback) override;
   void GetPlaylist(const std::string& id,
                    PlaylistPageHandler::GetPlaylistCallback callback) override;
+  void GetPlaylistItems(
+      const std::string& playlist_id,
+      uint32_t offset,
+      uint32_t count,
+      PlaylistPageHandler::GetPlaylistItemsCallback callback) override;
   void AddMediaFilesFromPageToPlaylist(const std::string& playlist_id,
                                        const GURL& url) override;
   void AddMediaFilesFromOpenTabsToPlaylist(
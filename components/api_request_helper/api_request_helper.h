@@ -9,6 +9,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "base/callback.h"
 #include "base/callback_helpers.h"
@@ -53,6 +54,8 @@ class APIRequestResult {
   const std::string& body() const { return body_; }
   // `base::Value` of sanitized json response.
   const base::Value& value_body() const { return value_body_; }
+  // Moves the `base::Value` out, e.g. to parse it on another sequence.
+  base::Value TakeValueBody() { return std::move(value_body_); }
   // HTTP response headers.
   const base::flat_map<std::string, std::string>& headers() const {
     return headers_;
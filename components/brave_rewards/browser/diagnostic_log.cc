@@ -5,11 +5,14 @@
 
 #include "brave/components/brave_rewards/browser/diagnostic_log.h"
 
-#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "base/files/file.h"
 #include "base/files/file_util.h"
 #include "base/i18n/time_formatting.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/thread_pool.h"
@@ -19,6 +22,11 @@ namespace {
 const int64_t kChunkSize = 1024;
 const size_t kDividerLength = 80;
 
+// Buffered entries are written once this much is pending, or after
+// |kFlushDelay| otherwise.
+const size_t kMaxPendingSize = 64 * 1024;
+constexpr base::TimeDelta kFlushDelay = base::Seconds(1);
+
 std::string FormatTime(const base::Time& time) {
   return base::UTF16ToUTF8(
       base::TimeFormatWithPattern(time, "MMM dd, YYYY h::mm::ss.S a"));
@@ -47,41 +55,30 @@ std::string GetLogVerboseLevelName(int verbose_level) {
   return verbose_level_name;
 }
 
-bool Create(const base::FilePath& file_path, base::File* file) {
-  DCHECK(file);
-
-  file->Initialize(file_path, base::File::FLAG_CREATE_ALWAYS |
-                                  base::File::FLAG_READ |
-                                  base::File::FLAG_WRITE);
+base::FilePath GetSegmentPath(const base::FilePath& file_path, int segment) {
+  if (segment == 0) {
+    return file_path;
+  }
 
-  return file->IsValid();
+  return file_path.AddExtensionASCII(base::NumberToString(segment));
 }
 
 bool Open(const base::FilePath& file_path, base::File* file) {
   DCHECK(file);
 
-  file->Initialize(file_path, base::File::FLAG_OPEN | base::File::FLAG_READ |
-                                  base::File::FLAG_WRITE);
+  file->Initialize(file_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
 
   return file->IsValid();
 }
 
-bool CreateOrOpen(const base::FilePath& file_path, base::File* file) {
+// Returns the offset of the first of the last |num_lines| lines of |file|.
+// |line_count| is set to the number of lines found, which is less than
+// |num_lines| if the file is too short.
+int64_t SeekFromEnd(base::File* file, int num_lines, int* line_count) {
   DCHECK(file);
+  DCHECK(line_count);
 
-  if (!base::PathExists(file_path)) {
-    return Create(file_path, file);
-  }
-
-  if (!Open(file_path, file)) {
-    return false;
-  }
-
-  return file->IsValid();
-}
-
-int64_t SeekFromEnd(base::File* file, int num_lines) {
-  DCHECK(file);
+  *line_count = 0;
 
   if (!file->IsValid()) {
     return 0;
@@ -100,8 +97,6 @@ int64_t SeekFromEnd(base::File* file, int num_lines) {
     return 0;
   }
 
-  int line_count = 0;
-
   char chunk[kChunkSize];
   int64_t chunk_size = kChunkSize;
   int64_t last_chunk_size = 0;
@@ -126,10 +121,10 @@ int64_t SeekFromEnd(base::File* file, int num_lines) {
 
     for (int i = chunk_size - 1; i >= 0; i--) {
       if (chunk[i] == '\n') {
-        line_count++;
-        if (line_count == num_lines + 1) {
+        if (*line_count == num_lines) {
           return length;
         }
+        (*line_count)++;
       }
 
       length--;
@@ -141,141 +136,120 @@ int64_t SeekFromEnd(base::File* file, int num_lines) {
   return length;
 }
 
-bool TrimBeginningOfFile(base::File* file, int keep_num_lines) {
+bool ReadFromOffset(base::File* file, int64_t offset, std::string* data) {
   DCHECK(file);
+  DCHECK(data);
 
-  if (file->GetLength() == 0) {
-    return true;
-  }
-
-  const int64_t offset = SeekFromEnd(file, keep_num_lines);
-  if (offset == -1) {
+  const int64_t length = file->GetLength();
+  if (length == -1 || offset > length) {
     return false;
   }
 
-  if (offset == 0) {
-    return true;
-  }
-
   if (file->Seek(base::File::FROM_BEGIN, offset) == -1) {
     return false;
   }
 
-  const int64_t size = file->GetLength() - offset;
-  std::unique_ptr<char[]> buffer = std::make_unique<char[]>(size + 1);
-
-  if (file->ReadAtCurrentPos(buffer.get(), size) == -1) {
-    return false;
-  }
-
-  if (file->Seek(base::File::FROM_BEGIN, 0) == -1) {
-    return false;
-  }
-
-  const std::string data = std::string(buffer.get());
-  const int64_t new_size = data.size();
-
-  if (file->WriteAtCurrentPos(data.c_str(), new_size) == -1) {
-    return false;
-  }
-
-  if (!file->SetLength(new_size)) {
-    return false;
-  }
-
-  return true;
-}
-
-bool MaybeTrimBeginningOfFile(base::File* file,
-                              int64_t max_file_size,
-                              int keep_num_lines,
-                              bool first_write) {
-  DCHECK(file);
-
-  const int64_t length = file->GetLength();
-  if (length == -1) {
-    return false;
-  }
-
-  // We do not trim the log on first run so that if the browser
-  // crashes and we investigate the log with the user they are able to
-  // re-run the browser without losing past logs.
-  if (!first_write && length <= max_file_size) {
+  data->resize(length - offset);
+  if (data->empty()) {
     return true;
   }
 
-  if (!TrimBeginningOfFile(file, keep_num_lines)) {
-    return false;
-  }
-
-  return true;
+  return file->ReadAtCurrentPos(data->data(), data->size()) ==
+         static_cast<int>(data->size());
 }
 
+// Reads segments from newest to oldest until |num_lines| lines are found, so
+// only the tail of the log that is needed is loaded.
 std::string ReadLastNLinesOnFileTaskRunner(const base::FilePath& file_path,
+                                           int max_segments,
                                            int num_lines) {
-  base::File file;
-  if (!Open(file_path, &file)) {
-    return "";
-  }
+  std::string log;
+  int remaining_lines = num_lines;
 
-  if (file.GetLength() == 0) {
-    return "";
-  }
+  for (int segment = 0; segment < max_segments && remaining_lines != 0;
+       segment++) {
+    base::File file;
+    if (!Open(GetSegmentPath(file_path, segment), &file)) {
+      break;
+    }
 
-  int64_t offset;
+    int64_t offset = 0;
+    int line_count = 0;
+    if (remaining_lines != -1) {
+      offset = SeekFromEnd(&file, remaining_lines, &line_count);
+      if (offset == -1) {
+        return "";
+      }
+    }
 
-  if (num_lines == -1) {
-    offset = 0;
-  } else {
-    offset = SeekFromEnd(&file, num_lines);
-    if (offset == -1) {
+    std::string data;
+    if (!ReadFromOffset(&file, offset, &data)) {
       return "";
     }
+    log.insert(0, data);
+
+    if (remaining_lines != -1) {
+      remaining_lines = offset > 0 ? 0 : remaining_lines - line_count;
+    }
   }
 
-  if (file.Seek(base::File::FROM_BEGIN, offset) == -1) {
-    return "";
+  return log;
+}
+
+// Shifts every segment one position older, dropping the oldest one, so that
+// the log stays bounded without rewriting any file contents.
+bool RotateSegments(const base::FilePath& file_path, int max_segments) {
+  const base::FilePath oldest_path =
+      GetSegmentPath(file_path, max_segments - 1);
+  if (!base::DeleteFile(oldest_path)) {
+    return false;
   }
 
-  const int64_t size = file.GetLength() - offset;
-  std::unique_ptr<char[]> buffer = std::make_unique<char[]>(size + 1);
+  for (int segment = max_segments - 2; segment >= 0; segment--) {
+    const base::FilePath segment_path = GetSegmentPath(file_path, segment);
+    if (!base::PathExists(segment_path)) {
+      continue;
+    }
 
-  if (file.ReadAtCurrentPos(buffer.get(), size) == -1) {
-    return "";
+    if (!base::Move(segment_path, GetSegmentPath(file_path, segment + 1))) {
+      return false;
+    }
   }
 
-  return std::string(buffer.get());
+  return true;
 }
 
 bool WriteOnFileTaskRunner(const base::FilePath& file_path,
-                           const std::string& log_entry,
-                           int64_t max_file_size,
-                           int keep_num_lines,
-                           bool first_write) {
-  base::File file;
-  if (!CreateOrOpen(file_path, &file)) {
-    return false;
+                           const std::string& log_entries,
+                           int64_t max_segment_size,
+                           int max_segments) {
+  int64_t size = 0;
+  if (base::GetFileSize(file_path, &size) && size >= max_segment_size) {
+    if (!RotateSegments(file_path, max_segments)) {
+      return false;
+    }
   }
 
-  if (file.Seek(base::File::FROM_END, 0) == -1) {
+  base::File file(file_path,
+                  base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_APPEND);
+  if (!file.IsValid()) {
     return false;
   }
 
-  if (first_write) {
-    const std::string divider = std::string(kDividerLength, '-') + "\n";
-    file.WriteAtCurrentPos(divider.c_str(), divider.length());
-  }
+  return file.WriteAtCurrentPos(log_entries.data(), log_entries.size()) ==
+         static_cast<int>(log_entries.size());
+}
 
-  if (file.WriteAtCurrentPos(log_entry.c_str(), log_entry.length()) == -1) {
-    return false;
+bool DeleteOnFileTaskRunner(const base::FilePath& file_path,
+                            int max_segments) {
+  bool result = true;
+  for (int segment = 0; segment < max_segments; segment++) {
+    if (!base::DeleteFile(GetSegmentPath(file_path, segment))) {
+      result = false;
+    }
   }
 
-  return MaybeTrimBeginningOfFile(&file, max_file_size, keep_num_lines,
-                                  first_write);
-}
-
-bool DeleteOnFileTaskRunner(const base::FilePath& file_path) {
-  return base::DeleteFile(file_path);
+  return result;
 }
 
 }  // namespace
@@ -283,25 +257,30 @@ bool DeleteOnFileTaskRunner(const base::FilePath& file_path) {
 namespace brave_rewards {
 
 DiagnosticLog::DiagnosticLog(const base::FilePath& file_path,
-                             int64_t max_file_size,
-                             int keep_num_lines)
+                             int64_t max_segment_size,
+                             int max_segments)
     : file_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
           {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       file_path_(file_path),
-      max_file_size_(max_file_size),
-      keep_num_lines_(keep_num_lines),
-      first_write_(true) {}
+      max_segment_size_(max_segment_size),
+      max_segments_(max_segments),
+      first_write_(true) {
+  DCHECK_GT(max_segments_, 0);
+}
 
 DiagnosticLog::~DiagnosticLog() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Flush();
 }
 
 void DiagnosticLog::ReadLastNLines(int num_lines, ReadCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Flush();
   file_task_runner_->PostTaskAndReplyWithResult(
       FROM_HERE,
-      base::BindOnce(&ReadLastNLinesOnFileTaskRunner, file_path_, num_lines),
+      base::BindOnce(&ReadLastNLinesOnFileTaskRunner, file_path_,
+                     max_segments_, num_lines),
       base::BindOnce(&DiagnosticLog::OnReadLastNLines, AsWeakPtr(),
                      std::move(callback)));
 }
@@ -309,13 +288,23 @@ void DiagnosticLog::ReadLastNLines(int num_lines, ReadCallback callback) {
 void DiagnosticLog::Write(const std::string& log_entry,
                           StatusCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  file_task_runner_->PostTaskAndReplyWithResult(
-      FROM_HERE,
-      base::BindOnce(&WriteOnFileTaskRunner, file_path_, log_entry,
-                     max_file_size_, keep_num_lines_, first_write_),
-      base::BindOnce(&DiagnosticLog::OnWrite, AsWeakPtr(),
-                     std::move(callback)));
-  first_write_ = false;
+  if (first_write_) {
+    pending_log_entries_.append(kDividerLength, '-');
+    pending_log_entries_.append("\n");
+    first_write_ = false;
+  }
+
+  pending_log_entries_.append(log_entry);
+  pending_callbacks_.push_back(std::move(callback));
+
+  if (pending_log_entries_.size() >= kMaxPendingSize) {
+    Flush();
+    return;
+  }
+
+  if (!flush_timer_.IsRunning()) {
+    flush_timer_.Start(FROM_HERE, kFlushDelay, this, &DiagnosticLog::Flush);
+  }
 }
 
 void DiagnosticLog::Write(const std::string& log_entry,
@@ -341,21 +330,45 @@ void DiagnosticLog::Write(const std::string& log_entry,
 
 void DiagnosticLog::Delete(StatusCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Flush();
   file_task_runner_->PostTaskAndReplyWithResult(
-      FROM_HERE, base::BindOnce(&DeleteOnFileTaskRunner, file_path_),
+      FROM_HERE,
+      base::BindOnce(&DeleteOnFileTaskRunner, file_path_, max_segments_),
       base::BindOnce(&DiagnosticLog::OnDelete, AsWeakPtr(),
                      std::move(callback)));
 }
 
+void DiagnosticLog::Flush() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  flush_timer_.Stop();
+
+  if (pending_log_entries_.empty()) {
+    return;
+  }
+
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&WriteOnFileTaskRunner, file_path_,
+                     std::move(pending_log_entries_), max_segment_size_,
+                     max_segments_),
+      base::BindOnce(&DiagnosticLog::OnWrite, AsWeakPtr(),
+                     std::move(pending_callbacks_)));
+  pending_log_entries_.clear();
+  pending_callbacks_.clear();
+}
+
 void DiagnosticLog::OnReadLastNLines(ReadCallback callback,
                                      const std::string& data) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   std::move(callback).Run(data);
 }
 
-void DiagnosticLog::OnWrite(StatusCallback callback, bool result) {
+void DiagnosticLog::OnWrite(std::vector<StatusCallback> callbacks,
+                            bool result) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  std::move(callback).Run(result);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(result);
+  }
 }
 
 void DiagnosticLog::OnDelete(StatusCallback callback, bool result) {
@@ -7,22 +7,25 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_DIAGNOSTIC_LOG_H_
 
 #include <string>
+#include <vector>
 
-#include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/sequence_checker.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/timer/timer.h"
 
 namespace brave_rewards {
 
-// This class provides access to a diagnostic log file. If the file
-// size ever exceeds the provided maximum file size, it is trimmed to
-// keep only the last n lines.
+// This class provides access to a diagnostic log which is split across
+// |max_segments| files: |path| is the segment being written and |path|.1,
+// |path|.2, ... are older segments. Entries are buffered in memory and
+// appended in batches. Once the current segment exceeds |max_segment_size|
+// it is rotated and the oldest segment is dropped.
 class DiagnosticLog : public base::SupportsWeakPtr<DiagnosticLog> {
  public:
   DiagnosticLog(const base::FilePath& path,
-                int64_t max_file_size,
-                int keep_num_lines);
+                int64_t max_segment_size,
+                int max_segments);
   DiagnosticLog(const DiagnosticLog&) = delete;
   DiagnosticLog& operator=(const DiagnosticLog&) = delete;
   ~DiagnosticLog();
@@ -30,13 +33,12 @@ class DiagnosticLog : public base::SupportsWeakPtr<DiagnosticLog> {
   using ReadCallback = base::OnceCallback<void(const std::string& data)>;
   using StatusCallback = base::OnceCallback<void(bool result)>;
 
-  // Reads last |num_lines| lines of file. If |num_lines| is -1, reads
-  // the entire file.
+  // Reads last |num_lines| lines of the log. If |num_lines| is -1, reads
+  // the entire log.
   void ReadLastNLines(int num_lines, ReadCallback callback);
 
-  // Appends |log_entry| to end of file. If file doesn't exist, it is
-  // created. If total file size exceeds |max_file_size|, removes all
-  // but the last |keep_num_lines| lines.
+  // Appends |log_entry| to the log. |callback| is run once the batch
+  // containing the entry has been written.
   void Write(const std::string& log_entry, StatusCallback callback);
   void Write(const std::string& log_entry,
              const base::Time& time,
@@ -45,20 +47,27 @@ class DiagnosticLog : public base::SupportsWeakPtr<DiagnosticLog> {
              int verbose_level,
              StatusCallback callback);
 
-  // Deletes the file.
+  // Deletes all segments of the log.
   void Delete(StatusCallback callback);
 
  private:
+  // Posts the buffered entries to the file task runner.
+  void Flush();
+
   void OnReadLastNLines(ReadCallback callback, const std::string& data);
-  void OnWrite(StatusCallback callback, bool result);
+  void OnWrite(std::vector<StatusCallback> callbacks, bool result);
   void OnDelete(StatusCallback callback, bool result);
 
   scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   base::FilePath file_path_;
-  int64_t max_file_size_;
-  int keep_num_lines_;
+  int64_t max_segment_size_;
+  int max_segments_;
   bool first_write_;
 
+  std::string pending_log_entries_;
+  std::vector<StatusCallback> pending_callbacks_;
+  base::OneShotTimer flush_timer_;
+
   SEQUENCE_CHECKER(sequence_checker_);
 };
 
@@ -0,0 +1,132 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/diagnostic_log.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_rewards {
+
+namespace {
+
+const char kDivider[] =
+    "--------------------------------------------------------------------------"
+    "------\n";
+
+}  // namespace
+
+class RewardsDiagnosticLogTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    log_path_ = temp_dir_.GetPath().AppendASCII("Rewards.log");
+  }
+
+  void CreateLog(int64_t max_segment_size, int max_segments) {
+    log_ = std::make_unique<DiagnosticLog>(log_path_, max_segment_size,
+                                           max_segments);
+  }
+
+  void Write(const std::string& log_entry) {
+    log_->Write(log_entry, base::BindOnce([](bool result) {
+                  EXPECT_TRUE(result);
+                }));
+  }
+
+  std::string ReadLastNLines(int num_lines) {
+    std::string log;
+    base::RunLoop run_loop;
+    log_->ReadLastNLines(
+        num_lines, base::BindLambdaForTesting([&](const std::string& data) {
+          log = data;
+          run_loop.Quit();
+        }));
+    run_loop.Run();
+    return log;
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  base::ScopedTempDir temp_dir_;
+  base::FilePath log_path_;
+  std::unique_ptr<DiagnosticLog> log_;
+};
+
+TEST_F(RewardsDiagnosticLogTest, BuffersWrites) {
+  CreateLog(1024, 2);
+  Write("one\n");
+  Write("two\n");
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(base::PathExists(log_path_));
+
+  task_environment_.FastForwardBy(base::Seconds(1));
+  task_environment_.RunUntilIdle();
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(log_path_, &contents));
+  EXPECT_EQ(contents, std::string(kDivider) + "one\ntwo\n");
+}
+
+TEST_F(RewardsDiagnosticLogTest, ReadLastNLines) {
+  CreateLog(1024, 2);
+  Write("one\n");
+  Write("two\n");
+  Write("three\n");
+
+  EXPECT_EQ(ReadLastNLines(0), "");
+  EXPECT_EQ(ReadLastNLines(2), "two\nthree\n");
+  EXPECT_EQ(ReadLastNLines(-1), std::string(kDivider) + "one\ntwo\nthree\n");
+}
+
+TEST_F(RewardsDiagnosticLogTest, ReadLastNLinesAcrossSegments) {
+  CreateLog(4, 3);
+  Write("one\n");
+  EXPECT_EQ(ReadLastNLines(1), "one\n");
+  Write("two\n");
+  EXPECT_EQ(ReadLastNLines(1), "two\n");
+  Write("three\n");
+
+  EXPECT_EQ(ReadLastNLines(3), "one\ntwo\nthree\n");
+  EXPECT_TRUE(base::PathExists(log_path_.AddExtensionASCII("1")));
+  EXPECT_TRUE(base::PathExists(log_path_.AddExtensionASCII("2")));
+}
+
+TEST_F(RewardsDiagnosticLogTest, RotationDropsOldestSegment) {
+  CreateLog(4, 2);
+  Write("one\n");
+  EXPECT_EQ(ReadLastNLines(1), "one\n");
+  Write("two\n");
+  EXPECT_EQ(ReadLastNLines(1), "two\n");
+  Write("three\n");
+
+  EXPECT_EQ(ReadLastNLines(-1), "two\nthree\n");
+}
+
+TEST_F(RewardsDiagnosticLogTest, Delete) {
+  CreateLog(8, 2);
+  Write("one\n");
+  EXPECT_EQ(ReadLastNLines(1), "one\n");
+  Write("two\n");
+
+  base::RunLoop run_loop;
+  log_->Delete(base::BindLambdaForTesting([&](bool result) {
+    EXPECT_TRUE(result);
+    run_loop.Quit();
+  }));
+  run_loop.Run();
+
+  EXPECT_FALSE(base::PathExists(log_path_));
+  EXPECT_FALSE(base::PathExists(log_path_.AddExtensionASCII("1")));
+  EXPECT_EQ(ReadLastNLines(-1), "");
+}
+
+}  // namespace brave_rewards
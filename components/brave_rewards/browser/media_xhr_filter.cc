@@ -0,0 +1,98 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/media_xhr_filter.h"
+
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "url/url_constants.h"
+
+namespace brave_rewards {
+
+namespace {
+
+enum class MediaLoadRequirement {
+  kNone,
+  // Twitch video segments only count when played on a Twitch page.
+  kTwitchPlayer,
+};
+
+struct MediaEndpoint {
+  // Host the load goes to. Subdomains match too when |match_subdomains|.
+  base::StringPiece host;
+  bool match_subdomains;
+  // Empty matches any path.
+  base::StringPiece path_prefix;
+  bool exact_path;
+  MediaLoadRequirement requirement;
+};
+
+// Keep in sync with `GetLinkType` of the handlers in
+// vendor/bat-native-ledger/src/bat/ledger/internal/legacy/media.
+constexpr MediaEndpoint kMediaEndpoints[] = {
+    // YouTube::GetLinkType
+    {"www.youtube.com", false, "/api/stats/watchtime", true,
+     MediaLoadRequirement::kNone},
+    {"m.youtube.com", false, "/api/stats/watchtime", true,
+     MediaLoadRequirement::kNone},
+    // Twitch::GetLinkType
+    {"ttvnw.net", true, "/v1/segment/", false,
+     MediaLoadRequirement::kTwitchPlayer},
+    // Vimeo::GetLinkType
+    {"fresnel.vimeocdn.com", false, "/add/player-stats", true,
+     MediaLoadRequirement::kNone},
+    // GitHub::GetLinkType
+    {"github.com", true, "", false, MediaLoadRequirement::kNone},
+};
+
+bool IsTwitchPlayer(const GURL& first_party_url, const GURL& referrer) {
+  const base::StringPiece first_party = first_party_url.possibly_invalid_spec();
+  return base::StartsWith(first_party, "https://www.twitch.tv/") ||
+         base::StartsWith(first_party, "https://m.twitch.tv/") ||
+         base::StartsWith(referrer.possibly_invalid_spec(),
+                          "https://player.twitch.tv/");
+}
+
+bool Matches(const MediaEndpoint& endpoint,
+             const GURL& url,
+             const GURL& first_party_url,
+             const GURL& referrer) {
+  if (endpoint.match_subdomains ? !url.DomainIs(endpoint.host)
+                                : url.host_piece() != endpoint.host) {
+    return false;
+  }
+
+  const base::StringPiece path = url.path_piece();
+  if (endpoint.exact_path ? path != endpoint.path_prefix
+                          : !base::StartsWith(path, endpoint.path_prefix)) {
+    return false;
+  }
+
+  switch (endpoint.requirement) {
+    case MediaLoadRequirement::kNone:
+      return true;
+    case MediaLoadRequirement::kTwitchPlayer:
+      return IsTwitchPlayer(first_party_url, referrer);
+  }
+}
+
+}  // namespace
+
+bool IsMediaActivityLoad(const GURL& url,
+                         const GURL& first_party_url,
+                         const GURL& referrer) {
+  if (!url.is_valid() || !url.SchemeIs(url::kHttpsScheme)) {
+    return false;
+  }
+
+  for (const auto& endpoint : kMediaEndpoints) {
+    if (Matches(endpoint, url, first_party_url, referrer)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace brave_rewards
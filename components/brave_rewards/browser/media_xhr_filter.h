@@ -0,0 +1,23 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_XHR_FILTER_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_XHR_FILTER_H_
+
+#include "url/gurl.h"
+
+namespace brave_rewards {
+
+// Returns true if a finished resource load may carry media activity for one
+// of the ledger media handlers (YouTube, Twitch, Vimeo, GitHub). This mirrors
+// the handlers' `GetLinkType` checks so that everything else can be dropped
+// before parsing the query or sending it to the ledger process.
+bool IsMediaActivityLoad(const GURL& url,
+                         const GURL& first_party_url,
+                         const GURL& referrer);
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_MEDIA_XHR_FILTER_H_
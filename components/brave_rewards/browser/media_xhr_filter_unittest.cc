@@ -0,0 +1,73 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/media_xhr_filter.h"
+
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_rewards {
+
+class RewardsMediaXHRFilterTest : public testing::Test {
+ protected:
+  bool IsMediaLoad(const std::string& url,
+                   const std::string& first_party_url = "",
+                   const std::string& referrer = "") {
+    return IsMediaActivityLoad(GURL(url), GURL(first_party_url),
+                               GURL(referrer));
+  }
+};
+
+TEST_F(RewardsMediaXHRFilterTest, YouTube) {
+  EXPECT_TRUE(IsMediaLoad(
+      "https://www.youtube.com/api/stats/watchtime?docid=abc&st=0&et=10"));
+  EXPECT_TRUE(IsMediaLoad("https://m.youtube.com/api/stats/watchtime?st=0"));
+
+  EXPECT_FALSE(IsMediaLoad("https://www.youtube.com/watch?v=abc"));
+  EXPECT_FALSE(IsMediaLoad("https://www.youtube.com/api/stats/playback"));
+  EXPECT_FALSE(IsMediaLoad("http://www.youtube.com/api/stats/watchtime"));
+  EXPECT_FALSE(IsMediaLoad("https://youtube.com.evil.com/api/stats/watchtime"));
+}
+
+TEST_F(RewardsMediaXHRFilterTest, Twitch) {
+  const std::string segment =
+      "https://video-edge-c2.ttvnw.net/v1/segment/abc.ts";
+
+  EXPECT_TRUE(IsMediaLoad(segment, "https://www.twitch.tv/brave"));
+  EXPECT_TRUE(IsMediaLoad(segment, "https://m.twitch.tv/brave"));
+  EXPECT_TRUE(IsMediaLoad(segment, "https://example.com/",
+                          "https://player.twitch.tv/?channel=brave"));
+
+  EXPECT_FALSE(IsMediaLoad(segment));
+  EXPECT_FALSE(IsMediaLoad(segment, "https://example.com/"));
+  EXPECT_FALSE(IsMediaLoad("https://video-edge-c2.ttvnw.net/v1/playlist/abc",
+                           "https://www.twitch.tv/brave"));
+}
+
+TEST_F(RewardsMediaXHRFilterTest, Vimeo) {
+  EXPECT_TRUE(
+      IsMediaLoad("https://fresnel.vimeocdn.com/add/player-stats?id=1"));
+
+  EXPECT_FALSE(IsMediaLoad("https://fresnel.vimeocdn.com/add/other"));
+  EXPECT_FALSE(IsMediaLoad("https://vimeo.com/add/player-stats"));
+}
+
+TEST_F(RewardsMediaXHRFilterTest, GitHub) {
+  EXPECT_TRUE(IsMediaLoad("https://github.com/brave"));
+  EXPECT_TRUE(IsMediaLoad("https://api.github.com/users/brave"));
+
+  EXPECT_FALSE(IsMediaLoad("https://notgithub.com/brave"));
+}
+
+TEST_F(RewardsMediaXHRFilterTest, UnrelatedLoads) {
+  EXPECT_FALSE(IsMediaLoad("https://brave.com/"));
+  EXPECT_FALSE(IsMediaLoad("https://cdn.example.com/app.js?v=1"));
+  EXPECT_FALSE(IsMediaLoad("invalid-url"));
+  EXPECT_FALSE(IsMediaLoad("file:///a/b/c/"));
+}
+
+}  // namespace brave_rewards
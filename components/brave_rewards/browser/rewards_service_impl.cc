@@ -36,6 +36,7 @@
 #include "base/task/thread_pool.h"
 #include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "bat/ledger/global_constants.h"
 #include "bat/ledger/public/ledger_database.h"
 #include "brave/browser/ui/webui/brave_rewards_source.h"
@@ -43,6 +44,7 @@
 #include "brave/components/brave_rewards/browser/android_util.h"
 #include "brave/components/brave_rewards/browser/diagnostic_log.h"
 #include "brave/components/brave_rewards/browser/logging.h"
+#include "brave/components/brave_rewards/browser/media_xhr_filter.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service_impl.h"
 #include "brave/components/brave_rewards/browser/rewards_p3a.h"
@@ -99,10 +101,17 @@ static const unsigned int kRetriesCountOnNetworkChange = 1;
 namespace {
 
 constexpr int kDiagnosticLogMaxVerboseLevel = 6;
-constexpr int kDiagnosticLogKeepNumLines = 20000;
-constexpr int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
+constexpr int kDiagnosticLogMaxSegments = 5;
+constexpr int kDiagnosticLogMaxSegmentSize = 2 * (1024 * 1024);
 constexpr char pref_prefix[] = "brave.rewards";
 
+// Media activity on desktop is reported by Greaselion scripts, so the ledger
+// ignores resource loads there (see `HandledByGreaselion` in media.cc).
+constexpr bool kProcessMediaActivityLoads = BUILDFLAG(IS_ANDROID);
+
+// Media loads are sent to the ledger process in batches, one per tab.
+constexpr base::TimeDelta kPendingXHRLoadsDelay = base::Seconds(1);
+
 std::string URLMethodToRequestType(ledger::mojom::UrlMethod method) {
   switch (method) {
     case ledger::mojom::UrlMethod::GET:
@@ -347,8 +356,8 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       publisher_list_path_(profile->GetPath().Append(kPublishers_list)),
       diagnostic_log_(
           new DiagnosticLog(profile_->GetPath().Append(kDiagnosticLogPath),
-                            kDiagnosticLogMaxFileSize,
-                            kDiagnosticLogKeepNumLines)),
+                            kDiagnosticLogMaxSegmentSize,
+                            kDiagnosticLogMaxSegments)),
       notification_service_(new RewardsNotificationServiceImpl(profile)),
       next_timer_id_(0) {
   // Set up the rewards data source
@@ -887,30 +896,47 @@ void RewardsServiceImpl::OnXHRLoad(SessionID tab_id,
                                    const GURL& url,
                                    const GURL& first_party_url,
                                    const GURL& referrer) {
-  if (!Connected()) {
+  if (!kProcessMediaActivityLoads || !Connected()) {
     return;
   }
 
-  if (!ProcessPublisher(url)) {
+  if (!ProcessPublisher(url) ||
+      !IsMediaActivityLoad(url, first_party_url, referrer)) {
     return;
   }
 
-  base::flat_map<std::string, std::string> parts;
-
+  auto load = bat_ledger::mojom::XHRLoad::New();
+  load->url = url.spec();
+  load->first_party_url = first_party_url.spec();
+  load->referrer = referrer.spec();
   for (net::QueryIterator it(url); !it.IsAtEnd(); it.Advance()) {
-    parts[std::string(it.GetKey())] = it.GetUnescapedValue();
+    load->parts[std::string(it.GetKey())] = it.GetUnescapedValue();
   }
 
-  ledger::mojom::VisitDataPtr data = ledger::mojom::VisitData::New();
-  data->path = url.spec();
-  data->tab_id = tab_id.id();
+  pending_xhr_loads_[tab_id.id()].push_back(std::move(load));
+
+  if (!pending_xhr_loads_timer_) {
+    pending_xhr_loads_timer_ = std::make_unique<base::OneShotTimer>();
+  }
+
+  if (!pending_xhr_loads_timer_->IsRunning()) {
+    pending_xhr_loads_timer_->Start(
+        FROM_HERE, kPendingXHRLoadsDelay, this,
+        &RewardsServiceImpl::SendPendingXHRLoads);
+  }
+}
+
+void RewardsServiceImpl::SendPendingXHRLoads() {
+  auto pending_xhr_loads = std::move(pending_xhr_loads_);
+  pending_xhr_loads_.clear();
+
+  if (!Connected()) {
+    return;
+  }
 
-  bat_ledger_->OnXHRLoad(tab_id.id(),
-                         url.spec(),
-                         parts,
-                         first_party_url.spec(),
-                         referrer.spec(),
-                         std::move(data));
+  for (auto& [tab_id, loads] : pending_xhr_loads) {
+    bat_ledger_->OnXHRLoads(tab_id, std::move(loads));
+  }
 }
 
 void RewardsServiceImpl::OnRestorePublishers(
@@ -956,6 +982,11 @@ void RewardsServiceImpl::Shutdown() {
 
   url_loaders_.clear();
 
+  if (pending_xhr_loads_timer_ && pending_xhr_loads_timer_->IsRunning()) {
+    pending_xhr_loads_timer_->Stop();
+    SendPendingXHRLoads();
+  }
+
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
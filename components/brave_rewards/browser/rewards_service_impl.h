@@ -382,6 +382,8 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnRestorePublishers(const ledger::mojom::Result result);
 
+  void SendPendingXHRLoads();
+
   void OnRecurringTip(const ledger::mojom::Result result);
 
   void OnURLLoaderComplete(SimpleURLLoaderList::iterator url_loader_it,
@@ -627,6 +629,9 @@ class RewardsServiceImpl : public RewardsService,
       current_media_fetchers_;
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
+  std::unique_ptr<base::OneShotTimer> pending_xhr_loads_timer_;
+  base::flat_map<uint32_t, std::vector<bat_ledger::mojom::XHRLoadPtr>>
+      pending_xhr_loads_;
   PrefChangeRegistrar profile_pref_change_registrar_;
 
   uint32_t next_timer_id_;
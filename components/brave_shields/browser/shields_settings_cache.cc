@@ -0,0 +1,103 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+namespace {
+
+bool AffectsShieldsSettings(ContentSettingsTypeSet content_type_set) {
+  if (content_type_set.ContainsAllTypes())
+    return true;
+
+  switch (content_type_set.GetType()) {
+    case ContentSettingsType::BRAVE_SHIELDS:
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_TRACKERS:
+    case ContentSettingsType::BRAVE_COSMETIC_FILTERING:
+    case ContentSettingsType::BRAVE_COOKIES:
+    case ContentSettingsType::BRAVE_REFERRERS:
+    case ContentSettingsType::BRAVE_FINGERPRINTING_V2:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::COOKIES:
+    case ContentSettingsType::JAVASCRIPT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+ShieldsSettingsCache::ShieldsSettingsCache(
+    HostContentSettingsMap* map,
+    scoped_refptr<content_settings::CookieSettings> cookie_settings,
+    size_t max_size)
+    : map_(map),
+      cookie_settings_(std::move(cookie_settings)),
+      snapshots_(max_size) {
+  DCHECK(map_);
+  content_settings_observation_.Observe(map_);
+  if (cookie_settings_)
+    cookie_settings_observation_.Observe(cookie_settings_.get());
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() = default;
+
+ShieldsSettingsSnapshot ShieldsSettingsCache::Get(const GURL& url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DCHECK(map_);
+
+  // Opaque origins, e.g. of data: URLs or an invalid URL, don't identify the
+  // URL they come from and settings can differ between those URLs, so their
+  // settings aren't cached.
+  const url::Origin origin = url::Origin::Create(url);
+  if (origin.opaque())
+    return ShieldsSettingsSnapshot::Resolve(map_, cookie_settings_.get(), url);
+
+  auto it = snapshots_.Get(origin);
+  if (it == snapshots_.end()) {
+    it = snapshots_.Put(
+        origin, ShieldsSettingsSnapshot::Resolve(map_, cookie_settings_.get(),
+                                                 origin.GetURL()));
+  }
+  return it->second;
+}
+
+void ShieldsSettingsCache::Shutdown() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  content_settings_observation_.Reset();
+  cookie_settings_observation_.Reset();
+  Clear();
+  cookie_settings_ = nullptr;
+  map_ = nullptr;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  if (AffectsShieldsSettings(content_type_set))
+    Clear();
+}
+
+void ShieldsSettingsCache::OnThirdPartyCookieBlockingChanged(
+    bool block_third_party_cookies) {
+  Clear();
+}
+
+void ShieldsSettingsCache::Clear() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  snapshots_.Clear();
+}
+
+}  // namespace brave_shields
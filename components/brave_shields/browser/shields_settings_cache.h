@@ -0,0 +1,81 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/scoped_observation.h"
+#include "base/sequence_checker.h"
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/cookie_settings.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/keyed_service/core/keyed_service.h"
+#include "url/origin.h"
+
+class GURL;
+
+namespace brave_shields {
+
+// Keeps resolved ShieldsSettingsSnapshots of recently used origins, so that
+// the network stack and worker farbling don't resolve every shields setting
+// for every request. All snapshots are dropped whenever a shields or cookie
+// setting changes, since a single wildcard rule can affect any origin.
+class ShieldsSettingsCache : public KeyedService,
+                             public content_settings::Observer,
+                             public content_settings::CookieSettings::Observer {
+ public:
+  static constexpr size_t kDefaultMaxSize = 256;
+
+  // |cookie_settings| may be null, see ShieldsSettingsSnapshot::Resolve().
+  ShieldsSettingsCache(
+      HostContentSettingsMap* map,
+      scoped_refptr<content_settings::CookieSettings> cookie_settings,
+      size_t max_size = kDefaultMaxSize);
+  ~ShieldsSettingsCache() override;
+
+  ShieldsSettingsCache(const ShieldsSettingsCache&) = delete;
+  ShieldsSettingsCache& operator=(const ShieldsSettingsCache&) = delete;
+
+  // Returns the shields settings of |url|'s origin.
+  ShieldsSettingsSnapshot Get(const GURL& url);
+
+  size_t size() const { return snapshots_.size(); }
+
+  // KeyedService:
+  void Shutdown() override;
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+  // content_settings::CookieSettings::Observer:
+  void OnThirdPartyCookieBlockingChanged(
+      bool block_third_party_cookies) override;
+
+ private:
+  void Clear();
+
+  raw_ptr<HostContentSettingsMap> map_ = nullptr;
+  scoped_refptr<content_settings::CookieSettings> cookie_settings_;
+  base::LRUCache<url::Origin, ShieldsSettingsSnapshot> snapshots_;
+
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      content_settings_observation_{this};
+  base::ScopedObservation<content_settings::CookieSettings,
+                          content_settings::CookieSettings::Observer>
+      cookie_settings_observation_{this};
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_CACHE_H_
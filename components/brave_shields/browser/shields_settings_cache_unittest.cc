@@ -0,0 +1,124 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/cookie_settings_factory.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ public:
+  void SetUp() override {
+    profile_ = std::make_unique<TestingProfile>();
+    map_ = HostContentSettingsMapFactory::GetForProfile(profile_.get());
+  }
+
+  std::unique_ptr<ShieldsSettingsCache> CreateCache(
+      size_t max_size = ShieldsSettingsCache::kDefaultMaxSize) {
+    return std::make_unique<ShieldsSettingsCache>(
+        map_, CookieSettingsFactory::GetForProfile(profile_.get()), max_size);
+  }
+
+ protected:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+  HostContentSettingsMap* map_ = nullptr;
+};
+
+TEST_F(ShieldsSettingsCacheTest, MatchesIndividualSettings) {
+  const GURL url("https://brave.com");
+  SetAdControlType(map_, ControlType::ALLOW, url);
+  SetFingerprintingControlType(map_, ControlType::BLOCK, url);
+  SetHTTPSEverywhereEnabled(map_, false, url);
+  SetNoScriptControlType(map_, ControlType::BLOCK, url);
+
+  auto cache = CreateCache();
+  const auto snapshot = cache->Get(url);
+  EXPECT_EQ(GetBraveShieldsEnabled(map_, url), snapshot.shields_enabled);
+  EXPECT_EQ(ControlType::ALLOW, snapshot.ad_control_type);
+  EXPECT_EQ(GetCosmeticFilteringControlType(map_, url),
+            snapshot.cosmetic_filtering_control_type);
+  auto cookie_settings = CookieSettingsFactory::GetForProfile(profile_.get());
+  EXPECT_EQ(GetCookieControlType(map_, cookie_settings.get(), url),
+            snapshot.cookie_control_type);
+  EXPECT_EQ(ControlType::BLOCK, snapshot.fingerprinting_control_type);
+  EXPECT_EQ(ControlType::BLOCK, snapshot.no_script_control_type);
+  EXPECT_FALSE(snapshot.https_everywhere_enabled);
+  EXPECT_EQ(AreReferrersAllowed(map_, url), snapshot.referrers_allowed);
+  cache->Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, CachesPerOrigin) {
+  auto cache = CreateCache();
+  cache->Get(GURL("https://brave.com/a"));
+  cache->Get(GURL("https://brave.com/b?c=d"));
+  EXPECT_EQ(1u, cache->size());
+  cache->Get(GURL("https://search.brave.com"));
+  EXPECT_EQ(2u, cache->size());
+
+  // Opaque origins aren't cached, since shields settings differ between an
+  // empty URL and a data: URL whichever is resolved first.
+  const GURL data_url("data:text/plain,test");
+  EXPECT_TRUE(cache->Get(GURL()).shields_enabled);
+  EXPECT_FALSE(cache->Get(data_url).shields_enabled);
+  EXPECT_TRUE(cache->Get(GURL()).shields_enabled);
+  EXPECT_FALSE(cache->Get(data_url).shields_enabled);
+  EXPECT_EQ(2u, cache->size());
+  cache->Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, EvictsLeastRecentlyUsed) {
+  auto cache = CreateCache(2);
+  cache->Get(GURL("https://a.com"));
+  cache->Get(GURL("https://b.com"));
+  cache->Get(GURL("https://c.com"));
+  EXPECT_EQ(2u, cache->size());
+  cache->Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, InvalidatedByShieldsSettingChange) {
+  const GURL url("https://brave.com");
+  auto cache = CreateCache();
+  EXPECT_TRUE(cache->Get(url).shields_enabled);
+  cache->Get(GURL("https://example.com"));
+  EXPECT_EQ(2u, cache->size());
+
+  SetBraveShieldsEnabled(map_, false, url);
+  EXPECT_EQ(0u, cache->size());
+  EXPECT_FALSE(cache->Get(url).shields_enabled);
+
+  // A wildcard rule affects every cached origin.
+  SetFingerprintingControlType(map_, ControlType::ALLOW, GURL());
+  EXPECT_EQ(ControlType::ALLOW, cache->Get(url).fingerprinting_control_type);
+
+  SetNoScriptControlType(map_, ControlType::BLOCK, url);
+  EXPECT_EQ(ControlType::BLOCK, cache->Get(url).no_script_control_type);
+  cache->Shutdown();
+}
+
+TEST_F(ShieldsSettingsCacheTest, KeptOnUnrelatedSettingChange) {
+  const GURL url("https://brave.com");
+  auto cache = CreateCache();
+  cache->Get(url);
+  map_->SetContentSettingDefaultScope(url, GURL(),
+                                      ContentSettingsType::GEOLOCATION,
+                                      CONTENT_SETTING_BLOCK);
+  EXPECT_EQ(1u, cache->size());
+  cache->Shutdown();
+}
+
+}  // namespace brave_shields
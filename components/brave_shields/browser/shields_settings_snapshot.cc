@@ -0,0 +1,36 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_settings_snapshot.h"
+
+#include "base/check.h"
+#include "url/gurl.h"
+
+namespace brave_shields {
+
+// static
+ShieldsSettingsSnapshot ShieldsSettingsSnapshot::Resolve(
+    HostContentSettingsMap* map,
+    content_settings::CookieSettings* cookie_settings,
+    const GURL& url) {
+  DCHECK(map);
+
+  ShieldsSettingsSnapshot snapshot;
+  snapshot.shields_enabled = GetBraveShieldsEnabled(map, url);
+  snapshot.ad_control_type = GetAdControlType(map, url);
+  snapshot.cosmetic_filtering_control_type =
+      GetCosmeticFilteringControlType(map, url);
+  if (cookie_settings) {
+    snapshot.cookie_control_type =
+        GetCookieControlType(map, cookie_settings, url);
+  }
+  snapshot.fingerprinting_control_type = GetFingerprintingControlType(map, url);
+  snapshot.no_script_control_type = GetNoScriptControlType(map, url);
+  snapshot.https_everywhere_enabled = GetHTTPSEverywhereEnabled(map, url);
+  snapshot.referrers_allowed = AreReferrersAllowed(map, url);
+  return snapshot;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,43 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+
+class GURL;
+class HostContentSettingsMap;
+
+namespace content_settings {
+class CookieSettings;
+}
+
+namespace brave_shields {
+
+// All shields decisions for one site, resolved together so that a request or
+// a navigation doesn't walk the content settings rules once per decision.
+// See ShieldsSettingsCache for a cached per-origin copy.
+struct ShieldsSettingsSnapshot {
+  // |cookie_settings| may be null, in which case |cookie_control_type| keeps
+  // its default value.
+  static ShieldsSettingsSnapshot Resolve(
+      HostContentSettingsMap* map,
+      content_settings::CookieSettings* cookie_settings,
+      const GURL& url);
+
+  bool shields_enabled = true;
+  ControlType ad_control_type = ControlType::BLOCK;
+  ControlType cosmetic_filtering_control_type = ControlType::BLOCK_THIRD_PARTY;
+  ControlType cookie_control_type = ControlType::BLOCK_THIRD_PARTY;
+  ControlType fingerprinting_control_type = ControlType::DEFAULT;
+  ControlType no_script_control_type = ControlType::ALLOW;
+  bool https_everywhere_enabled = true;
+  bool referrers_allowed = false;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_SETTINGS_SNAPSHOT_H_
@@ -0,0 +1,109 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/stringprintf.h"
+#include "base/test/task_environment.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/shields_settings_cache.h"
+#include "components/content_settings/core/browser/cookie_settings.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_perftests --filter=ShieldsSettingsCachePerfTest.*
+
+namespace brave_shields {
+
+namespace {
+
+constexpr int kWarmupRuns = 3;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 1;
+
+// Number of sites with their own shields settings, as for a profile where
+// the shields panel has been used a lot.
+constexpr int kSitesWithSettings = 1000;
+// Requests are made on behalf of a handful of open tabs.
+constexpr int kTabOrigins = 20;
+constexpr int kRequestsPerLap = 1000;
+
+class ShieldsSettingsCachePerfTest : public testing::Test {
+ public:
+  ShieldsSettingsCachePerfTest() {
+    content_settings::CookieSettings::RegisterProfilePrefs(prefs_.registry());
+    HostContentSettingsMap::RegisterProfilePrefs(prefs_.registry());
+    map_ = new HostContentSettingsMap(
+        &prefs_, false /* is_off_the_record */, false /* store_last_modified */,
+        false /* restore_session */, false /* should_record_metrics */);
+    cookie_settings_ = new content_settings::CookieSettings(
+        map_.get(), &prefs_, false, "chrome-extension");
+  }
+
+  ~ShieldsSettingsCachePerfTest() override { map_->ShutdownOnUIThread(); }
+
+  void SetUp() override {
+    for (int i = 0; i < kSitesWithSettings; ++i) {
+      const GURL url(base::StringPrintf("https://site%d.example", i));
+      SetAdControlType(map_.get(), ControlType::ALLOW, url);
+      SetFingerprintingControlType(map_.get(), ControlType::BLOCK, url);
+      SetCookieControlType(map_.get(), &prefs_, ControlType::BLOCK, url);
+    }
+    for (int i = 0; i < kTabOrigins; ++i) {
+      // Half of the tabs are on sites with their own settings.
+      tab_origins_.emplace_back(base::StringPrintf(
+          i % 2 ? "https://site%d.example" : "https://other%d.example", i));
+    }
+  }
+
+  template <typename ResolveFunction>
+  void RunTest(const std::string& story, ResolveFunction resolve) {
+    base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+    do {
+      for (int i = 0; i < kRequestsPerLap; ++i)
+        resolve(tab_origins_[i % tab_origins_.size()]);
+      timer.NextLap();
+    } while (!timer.HasTimeLimitExpired());
+
+    perf_test::PerfResultReporter reporter("ShieldsSettingsCache", story);
+    reporter.RegisterImportantMetric(".time_per_request", "us");
+    reporter.AddResult(".time_per_request",
+                       timer.TimePerLap().InMicrosecondsF() / kRequestsPerLap);
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+  scoped_refptr<HostContentSettingsMap> map_;
+  scoped_refptr<content_settings::CookieSettings> cookie_settings_;
+  std::vector<GURL> tab_origins_;
+};
+
+}  // namespace
+
+// What BraveRequestInfo::MakeCTX() and the request handlers resolved for
+// every request before the cache.
+TEST_F(ShieldsSettingsCachePerfTest, ResolvePerRequest) {
+  RunTest("resolve_individually", [this](const GURL& url) {
+    GetBraveShieldsEnabled(map_.get(), url);
+    GetAdControlType(map_.get(), url);
+    GetCosmeticFilteringControlType(map_.get(), url);
+    GetHTTPSEverywhereEnabled(map_.get(), url);
+    AreReferrersAllowed(map_.get(), url);
+    GetFingerprintingControlType(map_.get(), url);
+  });
+
+  ShieldsSettingsCache cache(map_.get(), cookie_settings_);
+  RunTest("cached_snapshot", [&cache](const GURL& url) { cache.Get(url); });
+  cache.Shutdown();
+}
+
+}  // namespace brave_shields
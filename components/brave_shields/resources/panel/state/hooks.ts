@@ -13,6 +13,16 @@ export function useSiteBlockInfoData () {
     const uiHandlerReceiver = new UIHandlerReceiver({
       onSiteBlockInfoChanged: (siteBlockInfo) => {
         setSiteBlockInfo(siteBlockInfo)
+      },
+      onBlockedResourcesAdded: (added, totalBlockedResources) => {
+        setSiteBlockInfo(siteBlockInfo => siteBlockInfo && {
+          ...siteBlockInfo,
+          totalBlockedResources,
+          adsList: [...siteBlockInfo.adsList, ...added.adsList],
+          httpRedirectsList: [...siteBlockInfo.httpRedirectsList, ...added.httpRedirectsList],
+          jsList: [...siteBlockInfo.jsList, ...added.jsList],
+          fingerprintsList: [...siteBlockInfo.fingerprintsList, ...added.fingerprintsList]
+        })
       }
     })
 
@@ -58,6 +58,10 @@ namespace {
 // The favicon size we desire. The favicons are rendered at 24x24 pixels but
 // they look quite a bit nicer if we get a 48x48 pixel icon and downscale it.
 constexpr uint32_t kDesiredFaviconSizePixels = 48;
+
+// The last built feed, stored in the profile directory.
+constexpr base::FilePath::CharType kFeedSnapshotFilename[] =
+    FILE_PATH_LITERAL("Brave News Feed");
 }  // namespace
 
 // static
@@ -78,7 +82,8 @@ BraveNewsController::BraveNewsController(
     favicon::FaviconService* favicon_service,
     brave_ads::AdsService* ads_service,
     history::HistoryService* history_service,
-    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+    const base::FilePath& profile_path)
     : prefs_(prefs),
       favicon_service_(favicon_service),
       ads_service_(ads_service),
@@ -99,7 +104,8 @@ BraveNewsController::BraveNewsController(
                        &channels_controller_,
                        history_service,
                        &api_request_helper_,
-                       prefs_),
+                       prefs_,
+                       profile_path.Append(kFeedSnapshotFilename)),
       suggestions_controller_(prefs_,
                               &publishers_controller_,
                               &api_request_helper_,
@@ -138,8 +144,9 @@ void BraveNewsController::Bind(
 }
 
 void BraveNewsController::ClearHistory() {
-  // TODO(petemill): Clear history once/if we actually store
-  // feed cache somewhere.
+  // The feed is ordered by visited hosts, so drop it along with its
+  // persisted snapshot.
+  feed_controller_.ClearCache();
 }
 
 mojo::PendingRemote<mojom::BraveNewsController>
@@ -616,6 +623,8 @@ void BraveNewsController::ConditionallyStartOrStopTimer() {
   MaybeInitPrefs();
   // Refresh data on an interval only if Brave News is enabled
   if (GetIsEnabled()) {
+    // Show the last feed while the first fetch is pending.
+    feed_controller_.LoadFeedSnapshot();
     VLOG(1) << "STARTING TIMERS";
     if (!timer_feed_update_.IsRunning()) {
       timer_feed_update_.Start(FROM_HERE, base::Hours(3), this,
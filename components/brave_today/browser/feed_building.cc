@@ -232,31 +232,20 @@ mojom::FeedItemMetadataPtr& MetadataFromFeedItem(
   }
 }
 
-}  // namespace
-
-bool ShouldDisplayFeedItem(const mojom::FeedItemPtr& feed_item,
-                           const Publishers* publishers,
-                           const Channels& channels) {
-  // Filter out articles from publishers we're ignoring
-  const auto& data = MetadataFromFeedItem(feed_item);
-  if (!publishers->contains(data->publisher_id)) {
-    VLOG(1) << "Found article with unknown publisher_id. PublisherId: "
-            << data->publisher_id;
-    return false;
-  }
-  const auto& publisher = publishers->at(data->publisher_id);
+bool ShouldDisplayPublisher(const mojom::Publisher* publisher,
+                            const Channels& channels) {
   if (publisher->user_enabled_status ==
       brave_news::mojom::UserEnabled::DISABLED) {
-    VLOG(1) << "Hiding article for disabled-by-user publisher "
-            << data->publisher_id << ": " << publisher->publisher_name;
+    VLOG(1) << "Hiding articles for disabled-by-user publisher "
+            << publisher->publisher_id << ": " << publisher->publisher_name;
     return false;
   }
 
   // Direct publishers should be shown, even though they aren't in any locales,
   // and their enabled status is |NOT_MODIFIED|.
   if (publisher->type == brave_news::mojom::PublisherType::DIRECT_SOURCE) {
-    VLOG(2) << "Showing article for direct feed " << data->publisher_id << ": "
-            << publisher->publisher_name
+    VLOG(2) << "Showing articles for direct feed " << publisher->publisher_id
+            << ": " << publisher->publisher_name
             << " because direct feeds are always shown.";
     return true;
   }
@@ -269,16 +258,16 @@ bool ShouldDisplayFeedItem(const mojom::FeedItemPtr& feed_item,
       // it belongs to are subscribed to.
       for (const auto& locale_info : publisher->locales) {
         for (const auto& channel_id : locale_info->channels) {
-          if (channels.contains(channel_id)) {
-            const auto& channel = channels.at(channel_id);
-            if (base::Contains(channel->subscribed_locales,
-                               locale_info->locale)) {
-              VLOG(2) << "Showing article because publisher "
-                      << data->publisher_id << ": " << publisher->publisher_name
-                      << " is in channel " << locale_info->locale << "."
-                      << channel_id << " which is subscribed to.";
-              return true;
-            }
+          auto channel = channels.find(channel_id);
+          if (channel != channels.end() &&
+              base::Contains(channel->second->subscribed_locales,
+                             locale_info->locale)) {
+            VLOG(2) << "Showing articles because publisher "
+                    << publisher->publisher_id << ": "
+                    << publisher->publisher_name << " is in channel "
+                    << locale_info->locale << "." << channel_id
+                    << " which is subscribed to.";
+            return true;
           }
         }
       }
@@ -289,38 +278,93 @@ bool ShouldDisplayFeedItem(const mojom::FeedItemPtr& feed_item,
     }
 
     if (!publisher->is_enabled) {
-      VLOG(2) << "Hiding article for disabled-by-default publisher "
-              << data->publisher_id << ": " << publisher->publisher_name;
+      VLOG(2) << "Hiding articles for disabled-by-default publisher "
+              << publisher->publisher_id << ": " << publisher->publisher_name;
       return false;
     }
   }
 
   // None of the filters match, we can display
-  VLOG(2) << "None of the filters matched, will display item for publisher "
-          << data->publisher_id << ": " << publisher->publisher_name << " ["
-          << data->title << "]";
+  VLOG(2) << "None of the filters matched, will display items for publisher "
+          << publisher->publisher_id << ": " << publisher->publisher_name;
   return true;
 }
 
+}  // namespace
+
+PublisherVisibility::PublisherVisibility(const Publishers& publishers,
+                                         const Channels& channels)
+    : publishers_(&publishers) {
+  publisher_indices_.reserve(publishers.size());
+  is_visible_.reserve(publishers.size());
+  for (const auto& [publisher_id, publisher] : publishers) {
+    publisher_indices_.emplace(publisher_id, is_visible_.size());
+    is_visible_.push_back(ShouldDisplayPublisher(publisher.get(), channels));
+  }
+}
+
+PublisherVisibility::~PublisherVisibility() = default;
+
+const mojom::Publisher* PublisherVisibility::GetVisiblePublisher(
+    const std::string& publisher_id) const {
+  auto it = publisher_indices_.find(publisher_id);
+  if (it == publisher_indices_.end()) {
+    VLOG(1) << "Found article with unknown publisher_id. PublisherId: "
+            << publisher_id;
+    return nullptr;
+  }
+  if (!is_visible_[it->second]) {
+    return nullptr;
+  }
+  return std::next(publishers_->begin(), it->second)->second.get();
+}
+
+bool ShouldDisplayFeedItem(const mojom::FeedItemPtr& feed_item,
+                           const Publishers* publishers,
+                           const Channels& channels) {
+  // Filter out articles from publishers we're ignoring
+  const auto& data = MetadataFromFeedItem(feed_item);
+  auto it = publishers->find(data->publisher_id);
+  if (it == publishers->end()) {
+    VLOG(1) << "Found article with unknown publisher_id. PublisherId: "
+            << data->publisher_id;
+    return false;
+  }
+  return ShouldDisplayPublisher(it->second.get(), channels);
+}
+
 bool BuildFeed(const std::vector<mojom::FeedItemPtr>& feed_items,
                const std::unordered_set<std::string>& history_hosts,
                Publishers* publishers,
                mojom::Feed* feed,
                PrefService* prefs) {
-  Channels channels =
-      ChannelsController::GetChannelsFromPublishers(*publishers, prefs);
+  return BuildFeed(
+      feed_items, history_hosts, publishers, feed,
+      ChannelsController::GetChannelsFromPublishers(*publishers, prefs));
+}
 
+bool BuildFeed(const std::vector<mojom::FeedItemPtr>& feed_items,
+               const std::unordered_set<std::string>& history_hosts,
+               Publishers* publishers,
+               mojom::Feed* feed,
+               const Channels& channels) {
   std::list<mojom::ArticlePtr> articles;
   std::list<mojom::PromotedArticlePtr> promoted_articles;
   std::list<mojom::DealPtr> deals;
   std::hash<std::string> hasher;
   base::flat_set<GURL> seen_articles;
 
+  // Visibility only depends on the publisher, so work it out once per
+  // publisher rather than for each of its articles.
+  const PublisherVisibility visibility(*publishers, channels);
+
   for (auto& item : feed_items) {
-    if (!ShouldDisplayFeedItem(item, publishers, channels)) {
+    auto& metadata = MetadataFromFeedItem(item);
+    const mojom::Publisher* publisher =
+        visibility.GetVisiblePublisher(metadata->publisher_id);
+    if (!publisher) {
       continue;
     }
-    auto& metadata = MetadataFromFeedItem(item);
     if (seen_articles.contains(metadata->url)) {
       VLOG(2) << "Skipping " << metadata->url
               << " because we've already seen it.";
@@ -328,10 +372,6 @@ bool BuildFeed(const std::vector<mojom::FeedItemPtr>& feed_items,
     }
 
     seen_articles.insert(metadata->url);
-    const auto& publisher = publishers->at(metadata->publisher_id);
-    // ShouldDisplayFeedItem should already have returned false
-    // if publishers doesn't have this publisher_id.
-    DCHECK(publisher);
     // Verify publisher_name field, this is still required for android.
     // TODO(petemill): Have android use publisher_id field and lookup publisher
     // name from its publisher list, so that we can avoid sending this
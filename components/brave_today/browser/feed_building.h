@@ -7,10 +7,12 @@
 #define BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_BUILDING_H_
 
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
 #include "brave/components/brave_today/browser/channels_controller.h"
 #include "brave/components/brave_today/browser/publishers_parsing.h"
 #include "brave/components/brave_today/common/brave_news.mojom-forward.h"
@@ -19,12 +21,43 @@
 
 namespace brave_news {
 
+// Whether articles from each publisher should be displayed, given the user's
+// channel subscriptions. Visibility only depends on the publisher, so it is
+// worked out once for every publisher and stored densely by its index in
+// |publishers|, instead of being re-derived for each feed item.
+// |publishers| must outlive this object and not be modified.
+class PublisherVisibility {
+ public:
+  PublisherVisibility(const Publishers& publishers, const Channels& channels);
+  PublisherVisibility(const PublisherVisibility&) = delete;
+  PublisherVisibility& operator=(const PublisherVisibility&) = delete;
+  ~PublisherVisibility();
+
+  // Returns the publisher if its articles should be displayed, or nullptr if
+  // it is hidden or unknown.
+  const mojom::Publisher* GetVisiblePublisher(
+      const std::string& publisher_id) const;
+
+ private:
+  raw_ptr<const Publishers> publishers_;
+  std::unordered_map<std::string, size_t> publisher_indices_;
+  std::vector<bool> is_visible_;
+};
+
 bool BuildFeed(const std::vector<mojom::FeedItemPtr>& feed_items,
                const std::unordered_set<std::string>& history_hosts,
                Publishers* publishers,
                mojom::Feed* feed,
                PrefService* prefs);
 
+// Same as above, but with the user's channels already resolved from prefs,
+// which makes it safe to call from a background sequence.
+bool BuildFeed(const std::vector<mojom::FeedItemPtr>& feed_items,
+               const std::unordered_set<std::string>& history_hosts,
+               Publishers* publishers,
+               mojom::Feed* feed,
+               const Channels& channels);
+
 // Exposed for testing
 bool ShouldDisplayFeedItem(const mojom::FeedItemPtr& feed_item,
                            const Publishers* publishers,
@@ -0,0 +1,195 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <iterator>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "base/strings/stringprintf.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/brave_today/browser/channels_controller.h"
+#include "brave/components/brave_today/browser/feed_building.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
+#include "brave/components/brave_today/common/features.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_perftests --filter=BraveNewsFeedBuildingPerfTest.*
+
+namespace brave_news {
+
+namespace {
+
+constexpr const char* kLocales[] = {"en_US", "en_CA", "en_GB",
+                                    "de_DE", "fr_FR", "ja_JP"};
+constexpr const char* kChannels[] = {"Top News", "Top Sources", "Technology",
+                                     "Business", "Sports", "Culture"};
+constexpr int kPublishersPerLocale = 150;
+constexpr int kItemsPerPublisher = 10;
+constexpr int kWarmupRuns = 3;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 1;
+
+Publishers CreatePublishers() {
+  Publishers publishers;
+  for (const char* locale : kLocales) {
+    for (int i = 0; i < kPublishersPerLocale; i++) {
+      auto locale_info = mojom::LocaleInfo::New();
+      locale_info->locale = locale;
+      locale_info->rank = i + 1;
+      locale_info->channels = {kChannels[i % std::size(kChannels)],
+                               kChannels[(i + 1) % std::size(kChannels)]};
+      std::vector<mojom::LocaleInfoPtr> locales;
+      locales.push_back(std::move(locale_info));
+
+      const std::string id = base::StringPrintf("%s-%d", locale, i);
+      // Every tenth publisher is explicitly followed or hidden by the user.
+      auto user_enabled = mojom::UserEnabled::NOT_MODIFIED;
+      if (i % 10 == 1)
+        user_enabled = mojom::UserEnabled::ENABLED;
+      else if (i % 10 == 2)
+        user_enabled = mojom::UserEnabled::DISABLED;
+      publishers[id] = mojom::Publisher::New(
+          id, mojom::PublisherType::COMBINED_SOURCE, "Publisher " + id,
+          "Top News", true, std::move(locales),
+          GURL("https://" + id + ".example.com/feed.xml"), absl::nullopt,
+          absl::nullopt, absl::nullopt, GURL("https://" + id + ".example.com"),
+          user_enabled);
+    }
+  }
+  return publishers;
+}
+
+// A subscription to a few channels in most, but not all, locales.
+Channels CreateChannels() {
+  Channels channels;
+  for (size_t i = 0; i < 3; i++) {
+    auto channel = mojom::Channel::New();
+    channel->channel_name = kChannels[i];
+    for (size_t j = 0; j < std::size(kLocales) - 1; j++)
+      channel->subscribed_locales.push_back(kLocales[j]);
+    channels[channel->channel_name] = std::move(channel);
+  }
+  return channels;
+}
+
+std::vector<mojom::FeedItemPtr> CreateFeedItems(const Publishers& publishers) {
+  std::vector<mojom::FeedItemPtr> feed_items;
+  const base::Time now = base::Time::Now();
+  int index = 0;
+  for (const auto& [id, publisher] : publishers) {
+    for (int i = 0; i < kItemsPerPublisher; i++, index++) {
+      const std::string url = base::StringPrintf(
+          "https://%s.example.com/article-%d/", id.c_str(), i);
+      auto metadata = mojom::FeedItemMetadata::New(
+          "Top News", now - base::Minutes(index % 2880),
+          "Title of article " + url, "Description of article " + url,
+          GURL(url), "", mojom::Image::NewPaddedImageUrl(GURL(url + "img.pad")),
+          id, publisher->publisher_name, (index * 7919) % 1000 / 10.0, "");
+      if (index % 50 == 0) {
+        feed_items.push_back(mojom::FeedItem::NewDeal(
+            mojom::Deal::New(std::move(metadata), "Deals")));
+      } else {
+        feed_items.push_back(mojom::FeedItem::NewArticle(
+            mojom::Article::New(std::move(metadata))));
+      }
+    }
+  }
+  return feed_items;
+}
+
+std::vector<mojom::FeedItemPtr> CloneFeedItems(
+    const std::vector<mojom::FeedItemPtr>& feed_items) {
+  std::vector<mojom::FeedItemPtr> clone;
+  clone.reserve(feed_items.size());
+  for (const auto& item : feed_items)
+    clone.push_back(item.Clone());
+  return clone;
+}
+
+}  // namespace
+
+class BraveNewsFeedBuildingPerfTest : public testing::Test {
+ protected:
+  BraveNewsFeedBuildingPerfTest()
+      : publishers_(CreatePublishers()),
+        channels_(CreateChannels()),
+        feed_items_(CreateFeedItems(publishers_)),
+        history_hosts_({"en_US-3.example.com", "de_DE-7.example.com"}) {
+    features_.InitAndEnableFeature(brave_today::features::kBraveNewsV2Feature);
+  }
+
+  void Report(const std::string& story, const base::LapTimer& timer) {
+    perf_test::PerfResultReporter reporter("BraveNewsFeedBuilding", story);
+    reporter.RegisterImportantMetric(".time", "ms");
+    reporter.AddResult(".time", timer.TimePerLap().InMillisecondsF());
+  }
+
+  mojom::FeedPtr Build() {
+    auto feed = mojom::Feed::New();
+    // BuildFeed moves the items it keeps, so each build needs its own copy.
+    EXPECT_TRUE(BuildFeed(CloneFeedItems(feed_items_), history_hosts_,
+                          &publishers_, feed.get(), channels_));
+    return feed;
+  }
+
+  base::test::ScopedFeatureList features_;
+  Publishers publishers_;
+  const Channels channels_;
+  const std::vector<mojom::FeedItemPtr> feed_items_;
+  const std::unordered_set<std::string> history_hosts_;
+};
+
+TEST_F(BraveNewsFeedBuildingPerfTest, BuildFeed) {
+  // The copy made for each build, to subtract from |build_feed|.
+  base::LapTimer clone_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    ASSERT_EQ(CloneFeedItems(feed_items_).size(), feed_items_.size());
+    clone_timer.NextLap();
+  } while (!clone_timer.HasTimeLimitExpired());
+  Report("clone_items", clone_timer);
+
+  base::LapTimer build_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    ASSERT_FALSE(Build()->pages.empty());
+    build_timer.NextLap();
+  } while (!build_timer.HasTimeLimitExpired());
+  Report("build_feed", build_timer);
+}
+
+TEST_F(BraveNewsFeedBuildingPerfTest, FeedSnapshot) {
+  auto feed = Build();
+
+  std::vector<uint8_t> data;
+  base::LapTimer serialize_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    data = mojom::Feed::Serialize(&feed);
+    ASSERT_FALSE(data.empty());
+    serialize_timer.NextLap();
+  } while (!serialize_timer.HasTimeLimitExpired());
+  Report("serialize_snapshot", serialize_timer);
+
+  base::LapTimer deserialize_timer(kWarmupRuns, kTimeLimit,
+                                   kTimeCheckInterval);
+  do {
+    auto restored = mojom::Feed::New();
+    ASSERT_TRUE(mojom::Feed::Deserialize(data.data(), data.size(), &restored));
+    ASSERT_EQ(restored->hash, feed->hash);
+    deserialize_timer.NextLap();
+  } while (!deserialize_timer.HasTimeLimitExpired());
+  Report("deserialize_snapshot", deserialize_timer);
+
+  perf_test::PerfResultReporter reporter("BraveNewsFeedBuilding", "snapshot");
+  reporter.RegisterImportantMetric(".size", "bytes");
+  reporter.AddResult(".size", data.size());
+}
+
+}  // namespace brave_news
@@ -452,6 +452,35 @@ TEST_F(BraveNewsFeedBuildingTest, ChannelIsUsedWhenV2IsEnabled) {
   EXPECT_FALSE(ShouldDisplayFeedItem(feed_item, &publisher_list, channels));
 }
 
+TEST_F(BraveNewsFeedBuildingTest, PublisherVisibility) {
+  base::test::ScopedFeatureList features;
+  features.InitAndEnableFeature(brave_today::features::kBraveNewsV2Feature);
+
+  Publishers publisher_list;
+  PopulatePublishers(&publisher_list);
+  publisher_list["222"]->user_enabled_status = mojom::UserEnabled::DISABLED;
+
+  Channels channels;
+  auto channel = mojom::Channel::New();
+  channel->channel_name = "Top Sources";
+  channel->subscribed_locales = {"en_US"};
+  channels["Top Sources"] = std::move(channel);
+
+  PublisherVisibility visibility(publisher_list, channels);
+  // In a subscribed channel.
+  EXPECT_EQ(visibility.GetVisiblePublisher("111"),
+            publisher_list["111"].get());
+  // Disabled by the user.
+  EXPECT_FALSE(visibility.GetVisiblePublisher("222"));
+  // Not in a subscribed channel.
+  EXPECT_FALSE(visibility.GetVisiblePublisher("333"));
+  // Enabled by the user.
+  EXPECT_EQ(visibility.GetVisiblePublisher("444"),
+            publisher_list["444"].get());
+  // Unknown publisher.
+  EXPECT_FALSE(visibility.GetVisiblePublisher("555"));
+}
+
 TEST_F(BraveNewsFeedBuildingTest, DuplicateItemsAreNotIncluded) {
   // Use v2 feed strategy by subscribing to a channel
   base::test::ScopedFeatureList features;
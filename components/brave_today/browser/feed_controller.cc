@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -18,9 +19,12 @@
 #include "base/bind.h"
 #include "base/callback_forward.h"
 #include "base/feature_list.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
 #include "base/logging.h"
 #include "base/one_shot_event.h"
 #include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/channels_controller.h"
@@ -43,6 +47,11 @@ namespace {
 
 const char kEtagHeaderKey[] = "etag";
 
+// Written ahead of the serialized mojom::Feed in the snapshot file. Bump it
+// whenever mojom::Feed or any struct it contains changes, so that snapshots
+// of other versions are dropped rather than misread.
+constexpr uint32_t kFeedSnapshotVersion = 1;
+
 GURL GetFeedUrl(const std::string& default_locale) {
   auto locale =
       base::FeatureList::IsEnabled(brave_today::features::kBraveNewsV2Feature)
@@ -53,6 +62,66 @@ GURL GetFeedUrl(const std::string& default_locale) {
   return feed_url;
 }
 
+FeedItems ParseFeedItemsOnTaskRunner(base::Value json_value) {
+  FeedItems feed_items;
+  ParseFeedItems(json_value, &feed_items);
+  return feed_items;
+}
+
+mojom::FeedPtr ReadFeedSnapshot(const base::FilePath& path) {
+  std::string data;
+  if (!base::ReadFileToString(path, &data)) {
+    return nullptr;
+  }
+  uint32_t version = 0;
+  if (data.size() < sizeof(version)) {
+    VLOG(1) << "Ignoring truncated Brave News feed snapshot";
+    return nullptr;
+  }
+  std::memcpy(&version, data.data(), sizeof(version));
+  if (version != kFeedSnapshotVersion) {
+    VLOG(1) << "Ignoring Brave News feed snapshot of version " << version;
+    return nullptr;
+  }
+  auto feed = mojom::Feed::New();
+  if (!mojom::Feed::Deserialize(data.data() + sizeof(version),
+                                data.size() - sizeof(version), &feed) ||
+      feed->hash.empty()) {
+    VLOG(1) << "Ignoring invalid Brave News feed snapshot";
+    return nullptr;
+  }
+  return feed;
+}
+
+void WriteFeedSnapshot(const base::FilePath& path, std::string data) {
+  if (!base::ImportantFileWriter::WriteFileAtomically(path, data)) {
+    LOG(ERROR) << "Failed to write Brave News feed snapshot";
+  }
+}
+
+std::pair<mojom::FeedPtr, std::string> BuildFeedOnTaskRunner(
+    FeedItems feed_items,
+    std::unordered_set<std::string> history_hosts,
+    Publishers publishers,
+    Channels channels) {
+  auto feed = mojom::Feed::New();
+  if (!BuildFeed(feed_items, history_hosts, &publishers, feed.get(),
+                 channels)) {
+    VLOG(1) << "ParseFeed reported failure.";
+  }
+  // Serialize the snapshot while we're still off the UI thread. It's only
+  // written once the UI thread knows the cache wasn't cleared meanwhile.
+  std::string snapshot;
+  if (!feed->hash.empty()) {
+    const uint32_t version = kFeedSnapshotVersion;
+    const std::vector<uint8_t> data = mojom::Feed::Serialize(&feed);
+    snapshot.reserve(sizeof(version) + data.size());
+    snapshot.append(reinterpret_cast<const char*>(&version), sizeof(version));
+    snapshot.append(data.begin(), data.end());
+  }
+  return {std::move(feed), std::move(snapshot)};
+}
+
 }  // namespace
 
 FeedController::FeedController(
@@ -61,7 +130,8 @@ FeedController::FeedController(
     ChannelsController* channels_controller,
     history::HistoryService* history_service,
     api_request_helper::APIRequestHelper* api_request_helper,
-    PrefService* prefs)
+    PrefService* prefs,
+    const base::FilePath& feed_snapshot_path)
     : prefs_(prefs),
       publishers_controller_(publishers_controller),
       direct_feed_controller_(direct_feed_controller),
@@ -69,7 +139,11 @@ FeedController::FeedController(
       history_service_(history_service),
       api_request_helper_(api_request_helper),
       on_current_update_complete_(new base::OneShotEvent()),
-      publishers_observation_(this) {
+      publishers_observation_(this),
+      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})),
+      feed_snapshot_path_(feed_snapshot_path) {
   publishers_observation_.Observe(publishers_controller);
 }
 
@@ -117,6 +191,7 @@ void FeedController::EnsureFeedIsUpdating() {
     return;
   }
   is_update_in_progress_ = true;
+  update_cache_generation_ = cache_generation_;
 
   // Fetch publishers via callback
   publishers_controller_->GetOrFetchPublishers(base::BindOnce(
@@ -172,18 +247,22 @@ void FeedController::EnsureFeedIsUpdating() {
                       history_hosts.insert(host);
                     }
                     VLOG(1) << "history hosts # " << history_hosts.size();
-                    // Parse directly to in-memory property
-                    controller->ResetFeed();
-                    std::vector<mojom::FeedItemPtr> feed_items;
-                    if (BuildFeed(all_feed_items, history_hosts, &publishers,
-                                  &controller->current_feed_,
-                                  controller->prefs_)) {
-                    } else {
-                      VLOG(1) << "ParseFeed reported failure.";
-                    }
-                    // Let any callbacks know that the data is ready
-                    // or errored.
-                    controller->NotifyUpdateDone();
+                    // Channels come from prefs, so they have to be read here,
+                    // the rest of the build happens off the UI thread. The
+                    // current feed keeps being served until it's done.
+                    Channels channels =
+                        ChannelsController::GetChannelsFromPublishers(
+                            publishers, controller->prefs_);
+                    controller->task_runner_->PostTaskAndReplyWithResult(
+                        FROM_HERE,
+                        base::BindOnce(&BuildFeedOnTaskRunner,
+                                       std::move(all_feed_items),
+                                       std::move(history_hosts),
+                                       std::move(publishers),
+                                       std::move(channels)),
+                        base::BindOnce(
+                            &FeedController::OnFeedBuilt,
+                            controller->weak_ptr_factory_.GetWeakPtr()));
                   },
                   base::Unretained(controller), std::move(all_feed_items),
                   std::move(publishers));
@@ -291,8 +370,28 @@ void FeedController::UpdateIfRemoteChanged() {
       base::Unretained(this)));
 }
 
+void FeedController::LoadFeedSnapshot() {
+  if (is_feed_snapshot_loaded_) {
+    return;
+  }
+  is_feed_snapshot_loaded_ = true;
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ReadFeedSnapshot, feed_snapshot_path_),
+      base::BindOnce(&FeedController::OnFeedSnapshotLoaded,
+                     weak_ptr_factory_.GetWeakPtr(), cache_generation_));
+}
+
 void FeedController::ClearCache() {
+  // Feeds being built or snapshots being read from before this point are
+  // dropped when they arrive.
+  cache_generation_++;
   ResetFeed();
+  is_feed_from_snapshot_ = false;
+  // Allow the snapshot of a later build to be restored again.
+  is_feed_snapshot_loaded_ = false;
+  task_runner_->PostTask(FROM_HERE,
+                         base::BindOnce(base::IgnoreResult(&base::DeleteFile),
+                                        feed_snapshot_path_));
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -354,9 +453,23 @@ void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
                 // Only mark cache time of remote request if
                 // parsing was successful
                 controller->locale_feed_etags_[locale] = etag;
-                FeedItems feed_items;
-                ParseFeedItems(api_request_result.value_body(), &feed_items);
-                std::move(callback).Run(std::move(feed_items));
+                // Multi-locale feeds can be large, parse them off the UI
+                // thread.
+                controller->task_runner_->PostTaskAndReplyWithResult(
+                    FROM_HERE,
+                    base::BindOnce(&ParseFeedItemsOnTaskRunner,
+                                   api_request_result.TakeValueBody()),
+                    base::BindOnce(
+                        [](base::WeakPtr<FeedController> controller,
+                           GetFeedItemsCallback callback,
+                           FeedItems feed_items) {
+                          if (!controller) {
+                            return;
+                          }
+                          std::move(callback).Run(std::move(feed_items));
+                        },
+                        controller->weak_ptr_factory_.GetWeakPtr(),
+                        std::move(callback)));
               },
               base::Unretained(controller), locale, locales_fetched_callback);
           // Send the request
@@ -378,11 +491,17 @@ void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
   if (!current_feed_.hash.empty()) {
     VLOG(1) << "getorfetchfeed(oc) from cache";
     std::move(callback).Run();
+    // A feed restored from the snapshot can be rendered right away, but
+    // should be refreshed behind it.
+    if (is_feed_from_snapshot_) {
+      EnsureFeedIsUpdating();
+    }
     return;
   }
   // Ensure feed is currently being fetched.
   // Subscribe to result of current feed fetch.
   on_current_update_complete_->Post(FROM_HERE, std::move(callback));
+  has_update_waiters_ = true;
   EnsureFeedIsUpdating();
 }
 
@@ -398,7 +517,9 @@ void FeedController::NotifyUpdateDone() {
   // Reset the OneShotEvent so that future requests
   // can be waited for.
   is_update_in_progress_ = false;
+  is_feed_from_snapshot_ = false;
   on_current_update_complete_ = std::make_unique<base::OneShotEvent>();
+  has_update_waiters_ = false;
 
   // Notify listeners.
   for (const auto& listener : listeners_) {
@@ -406,4 +527,46 @@ void FeedController::NotifyUpdateDone() {
   }
 }
 
+void FeedController::OnFeedBuilt(
+    std::pair<mojom::FeedPtr, std::string> feed_and_snapshot) {
+  if (update_cache_generation_ != cache_generation_) {
+    // The cache was cleared while this feed was being fetched. Neither keep
+    // nor persist it. Only fetch again if someone is waiting for a feed, as
+    // the cache is also cleared when Brave News gets disabled.
+    VLOG(1) << "Dropping Brave News feed built before the cache was cleared";
+    is_update_in_progress_ = false;
+    if (has_update_waiters_) {
+      EnsureFeedIsUpdating();
+    }
+    return;
+  }
+
+  auto& [feed, snapshot] = feed_and_snapshot;
+  // Persist the feed so the next session can show it immediately. Posted
+  // after any deletion from ClearCache(), and any later deletion is posted
+  // after it.
+  if (!snapshot.empty()) {
+    task_runner_->PostTask(FROM_HERE,
+                           base::BindOnce(&WriteFeedSnapshot,
+                                          feed_snapshot_path_,
+                                          std::move(snapshot)));
+  }
+  current_feed_ = std::move(*feed);
+  // Let any callbacks know that the data is ready or errored.
+  NotifyUpdateDone();
+}
+
+void FeedController::OnFeedSnapshotLoaded(uint64_t cache_generation,
+                                          mojom::FeedPtr feed) {
+  // A fresh feed may have been built, or the cache cleared, while the
+  // snapshot was being read.
+  if (!feed || !current_feed_.hash.empty() ||
+      cache_generation != cache_generation_) {
+    return;
+  }
+  VLOG(1) << "Restored feed snapshot: " << feed->hash;
+  current_feed_ = std::move(*feed);
+  is_feed_from_snapshot_ = true;
+}
+
 }  // namespace brave_news
@@ -6,14 +6,20 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CONTROLLER_H_
 #define BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CONTROLLER_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_today/browser/channels_controller.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
@@ -41,7 +47,8 @@ class FeedController : public PublishersController::Observer {
                  ChannelsController* channels_controller,
                  history::HistoryService* history_service,
                  api_request_helper::APIRequestHelper* api_request_helper,
-                 PrefService* prefs);
+                 PrefService* prefs,
+                 const base::FilePath& feed_snapshot_path);
   ~FeedController() override;
   FeedController(const FeedController&) = delete;
   FeedController& operator=(const FeedController&) = delete;
@@ -62,6 +69,11 @@ class FeedController : public PublishersController::Observer {
   // parsing).
   void EnsureFeedIsCached();
   void UpdateIfRemoteChanged();
+  // Restores the feed persisted after the last successful build, so that it
+  // can be rendered straight away while a fresh one is fetched. Only reads
+  // the snapshot once.
+  void LoadFeedSnapshot();
+  // Clears the in-memory feed and deletes the persisted snapshot.
   void ClearCache();
 
   // PublishersController::Observer
@@ -77,6 +89,10 @@ class FeedController : public PublishersController::Observer {
   void GetOrFetchFeed(base::OnceClosure callback);
   void ResetFeed();
   void NotifyUpdateDone();
+  // Takes the built feed and its serialized snapshot, which is empty when
+  // there's nothing to persist.
+  void OnFeedBuilt(std::pair<mojom::FeedPtr, std::string> feed_and_snapshot);
+  void OnFeedSnapshotLoaded(uint64_t cache_generation, mojom::FeedPtr feed);
 
   raw_ptr<PrefService> prefs_ = nullptr;
   raw_ptr<PublishersController> publishers_controller_ = nullptr;
@@ -90,6 +106,8 @@ class FeedController : public PublishersController::Observer {
   // Internal callers subscribe to this to know when the current in-progress
   // fetch and parse is complete.
   std::unique_ptr<base::OneShotEvent> on_current_update_complete_;
+  // Whether anything was posted to |on_current_update_complete_|.
+  bool has_update_waiters_ = false;
   base::ScopedObservation<PublishersController, PublishersController::Observer>
       publishers_observation_;
   mojo::RemoteSet<mojom::FeedListener> listeners_;
@@ -101,6 +119,23 @@ class FeedController : public PublishersController::Observer {
   // determine when we have available updates.
   base::flat_map<std::string, std::string> locale_feed_etags_;
   bool is_update_in_progress_ = false;
+
+  // Bumped by ClearCache(), so that feeds and snapshots which were already on
+  // their way aren't kept or persisted after it.
+  uint64_t cache_generation_ = 0;
+  // |cache_generation_| when the update in progress started.
+  uint64_t update_cache_generation_ = 0;
+
+  // Feed parsing, building and the snapshot file are all handled on this
+  // sequence, so that large feeds don't block the UI thread.
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  const base::FilePath feed_snapshot_path_;
+  bool is_feed_snapshot_loaded_ = false;
+  // Whether |current_feed_| was restored from the snapshot and still needs
+  // refreshing from remote.
+  bool is_feed_from_snapshot_ = false;
+
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
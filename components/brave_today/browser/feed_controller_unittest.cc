@@ -0,0 +1,162 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_today/browser/feed_controller.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "brave/components/brave_today/browser/channels_controller.h"
+#include "brave/components/brave_today/browser/direct_feed_controller.h"
+#include "brave/components/brave_today/browser/publishers_controller.h"
+#include "brave/components/brave_today/browser/unsupported_publisher_migrator.h"
+#include "brave/components/brave_today/browser/urls.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/history/core/browser/history_service.h"
+#include "components/history/core/test/history_service_test_util.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_news {
+
+namespace {
+
+constexpr char kPublishersResponse[] = R"([
+    {
+        "publisher_id": "111",
+        "publisher_name": "Test Publisher 1",
+        "feed_url": "https://tp1.example.com/feed",
+        "site_url": "https://tp1.example.com",
+        "category": "Tech",
+        "enabled": true
+    }
+])";
+
+constexpr char kFeedResponse[] = R"([
+    {
+        "category": "Tech",
+        "publish_time": "2021-09-01 07:01:28",
+        "url": "https://tp1.example.com/an-article/",
+        "title": "An article",
+        "description": "An article from the first publisher.",
+        "content_type": "article",
+        "publisher_id": "111",
+        "publisher_name": "Test Publisher 1",
+        "creative_instance_id": "",
+        "url_hash": "523b9f2091474c2a082c06ec17965f8c2392f871917407228bbeb51d8a55d6be",
+        "padded_img": "https://pcdn.brave.com/brave-today/cache/052e832456e00a3cee51c68eee206fe71c32cba35d5e53dee2777dd132e01364.jpg.pad",
+        "score": 13.93160989810695
+    }
+])";
+
+}  // namespace
+
+class FeedControllerTest : public testing::Test {
+ public:
+  FeedControllerTest()
+      : api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            test_url_loader_factory_.GetSafeWeakWrapper()),
+        direct_feed_controller_(profile_.GetPrefs(), nullptr),
+        unsupported_publisher_migrator_(profile_.GetPrefs(),
+                                        &direct_feed_controller_,
+                                        &api_request_helper_),
+        publishers_controller_(profile_.GetPrefs(),
+                               &direct_feed_controller_,
+                               &unsupported_publisher_migrator_,
+                               &api_request_helper_),
+        channels_controller_(profile_.GetPrefs(), &publishers_controller_) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    history_service_ =
+        history::CreateHistoryService(temp_dir_.GetPath(), true);
+    ASSERT_TRUE(history_service_);
+    feed_controller_ = std::make_unique<FeedController>(
+        &publishers_controller_, &direct_feed_controller_,
+        &channels_controller_, history_service_.get(), &api_request_helper_,
+        profile_.GetPrefs(), temp_dir_.GetPath().AppendASCII("feed"));
+
+    test_url_loader_factory_.AddResponse(GetSourcesUrl(), kPublishersResponse,
+                                         net::HTTP_OK);
+    test_url_loader_factory_.AddResponse(GetFeedUrl(), kFeedResponse,
+                                         net::HTTP_OK);
+    test_url_loader_factory_.SetInterceptor(
+        base::BindLambdaForTesting(
+            [&](const network::ResourceRequest& request) {
+              if (request.url.spec() == GetFeedUrl()) {
+                feed_request_count_++;
+              }
+            }));
+  }
+
+  void TearDown() override { feed_controller_.reset(); }
+
+  std::string GetSourcesUrl() {
+    return "https://" + brave_today::GetHostname() + "/sources." +
+           brave_today::GetRegionUrlPart() + "json";
+  }
+
+  std::string GetFeedUrl() {
+    return "https://" + brave_today::GetHostname() + "/brave-today/feed." +
+           brave_today::GetV1RegionUrlPart() + "json";
+  }
+
+ protected:
+  content::BrowserTaskEnvironment browser_task_environment_;
+  data_decoder::test::InProcessDataDecoder data_decoder_;
+  network::TestURLLoaderFactory test_url_loader_factory_;
+  api_request_helper::APIRequestHelper api_request_helper_;
+  TestingProfile profile_;
+  DirectFeedController direct_feed_controller_;
+  UnsupportedPublisherMigrator unsupported_publisher_migrator_;
+  PublishersController publishers_controller_;
+  ChannelsController channels_controller_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<history::HistoryService> history_service_;
+  std::unique_ptr<FeedController> feed_controller_;
+  int feed_request_count_ = 0;
+};
+
+TEST_F(FeedControllerTest, DoesNotRefetchFeedClearedWithoutWaiters) {
+  // Brave News getting disabled clears the cache of an update which nothing
+  // is waiting for.
+  feed_controller_->EnsureFeedIsUpdating();
+  feed_controller_->ClearCache();
+  browser_task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, feed_request_count_);
+
+  // The dropped update doesn't block the next one.
+  base::RunLoop loop;
+  feed_controller_->GetOrFetchFeed(
+      base::BindLambdaForTesting([&loop](mojom::FeedPtr feed) {
+        EXPECT_FALSE(feed->hash.empty());
+        loop.Quit();
+      }));
+  loop.Run();
+  EXPECT_EQ(2, feed_request_count_);
+}
+
+TEST_F(FeedControllerTest, RefetchesFeedClearedWithWaiters) {
+  base::RunLoop loop;
+  feed_controller_->GetOrFetchFeed(
+      base::BindLambdaForTesting([&loop](mojom::FeedPtr feed) {
+        EXPECT_FALSE(feed->hash.empty());
+        loop.Quit();
+      }));
+  feed_controller_->ClearCache();
+  loop.Run();
+  EXPECT_EQ(2, feed_request_count_);
+}
+
+}  // namespace brave_news
@@ -100,24 +100,21 @@ void AssetDiscoveryManager::DiscoverAssets(
 
   std::vector<mojom::BlockchainTokenPtr> user_assets =
       BraveWalletService::GetUserAssets(chain_id, mojom::CoinType::ETH, prefs_);
-  auto internal_callback =
-      base::BindOnce(&AssetDiscoveryManager::OnGetAllTokensDiscoverAssets,
-                     weak_ptr_factory_.GetWeakPtr(), chain_id,
-                     account_addresses, std::move(user_assets),
-                     triggered_by_accounts_added, from_block, to_block);
-
-  BlockchainRegistry::GetInstance()->GetAllTokens(
-      chain_id, mojom::CoinType::ETH, std::move(internal_callback));
+  DiscoverAssetsFromTokenList(
+      chain_id, account_addresses, std::move(user_assets),
+      triggered_by_accounts_added, from_block, to_block,
+      BlockchainRegistry::GetInstance()->GetTokenList(chain_id,
+                                                      mojom::CoinType::ETH));
 }
 
-void AssetDiscoveryManager::OnGetAllTokensDiscoverAssets(
+void AssetDiscoveryManager::DiscoverAssetsFromTokenList(
     const std::string& chain_id,
     const std::vector<std::string>& account_addresses,
     std::vector<mojom::BlockchainTokenPtr> user_assets,
     bool triggered_by_accounts_added,
     const std::string& from_block,
     const std::string& to_block,
-    std::vector<mojom::BlockchainTokenPtr> token_registry) {
+    scoped_refptr<const BlockchainTokenList> token_registry) {
   auto network_url = GetNetworkURL(prefs_, chain_id, mojom::CoinType::ETH);
   if (!network_url.is_valid()) {
     CompleteDiscoverAssets(
@@ -149,8 +146,11 @@ void AssetDiscoveryManager::OnGetAllTokensDiscoverAssets(
   base::Value::List contract_addresses_to_search;
   // Also create a map for addresses to blockchain tokens for easy lookup
   // for blockchain tokens in OnGetTransferLogs
+  // Only the tokens to search are copied out of the shared registry list.
   base::flat_map<std::string, mojom::BlockchainTokenPtr> tokens_to_search;
-  for (auto& registry_token : token_registry) {
+  const std::vector<mojom::BlockchainTokenPtr> no_tokens;
+  for (const auto& registry_token :
+       token_registry ? token_registry->tokens() : no_tokens) {
     if (registry_token->is_erc20 && !registry_token->contract_address.empty() &&
         !user_asset_contract_addresses.contains(
             registry_token->contract_address)) {
@@ -159,7 +159,7 @@ void AssetDiscoveryManager::OnGetAllTokensDiscoverAssets(
       const std::string lower_case_contract_address =
           base::ToLowerASCII(registry_token->contract_address);
       contract_addresses_to_search.Append(lower_case_contract_address);
-      tokens_to_search[lower_case_contract_address] = std::move(registry_token);
+      tokens_to_search[lower_case_contract_address] = registry_token.Clone();
     }
   }
 
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -21,6 +22,7 @@ class PrefService;
 
 namespace brave_wallet {
 
+class BlockchainTokenList;
 class BraveWalletService;
 class JsonRpcService;
 class KeyringService;
@@ -93,14 +95,14 @@ class AssetDiscoveryManager : public mojom::KeyringServiceObserver {
                       const std::string& from_block,
                       const std::string& to_block);
 
-  void OnGetAllTokensDiscoverAssets(
+  void DiscoverAssetsFromTokenList(
       const std::string& chain_id,
       const std::vector<std::string>& account_addresses,
       std::vector<mojom::BlockchainTokenPtr> user_assets,
       bool update_prefs,
       const std::string& from_block,
       const std::string& to_block,
-      std::vector<mojom::BlockchainTokenPtr> token_list);
+      scoped_refptr<const BlockchainTokenList> token_list);
 
   void OnGetTransferLogs(
       base::flat_map<std::string, mojom::BlockchainTokenPtr>& tokens_to_search,
@@ -7,7 +7,7 @@
 
 #include <utility>
 
-#include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -16,6 +16,43 @@
 
 namespace brave_wallet {
 
+namespace {
+
+std::string NormalizeContractAddress(const std::string& address) {
+  if (base::StartsWith(address, "0x", base::CompareCase::INSENSITIVE_ASCII))
+    return base::ToLowerASCII(address);
+  return address;
+}
+
+}  // namespace
+
+BlockchainTokenList::BlockchainTokenList(
+    std::vector<mojom::BlockchainTokenPtr> tokens)
+    : tokens_(std::move(tokens)) {
+  address_index_.reserve(tokens_.size());
+  symbol_index_.reserve(tokens_.size());
+  for (size_t i = 0; i < tokens_.size(); ++i) {
+    // emplace keeps the first entry for duplicates, like a linear search.
+    address_index_.emplace(
+        NormalizeContractAddress(tokens_[i]->contract_address), i);
+    symbol_index_.emplace(tokens_[i]->symbol, i);
+  }
+}
+
+BlockchainTokenList::~BlockchainTokenList() = default;
+
+const mojom::BlockchainToken* BlockchainTokenList::FindByAddress(
+    const std::string& contract_address) const {
+  auto it = address_index_.find(NormalizeContractAddress(contract_address));
+  return it == address_index_.end() ? nullptr : tokens_[it->second].get();
+}
+
+const mojom::BlockchainToken* BlockchainTokenList::FindBySymbol(
+    const std::string& symbol) const {
+  auto it = symbol_index_.find(symbol);
+  return it == symbol_index_.end() ? nullptr : tokens_[it->second].get();
+}
+
 BlockchainRegistry::BlockchainRegistry() = default;
 BlockchainRegistry::~BlockchainRegistry() = default;
 
@@ -36,13 +73,17 @@ void BlockchainRegistry::Bind(
 }
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
-  token_list_map_ = std::move(token_list_map);
+  token_lists_.clear();
+  for (auto& [key, list] : token_list_map) {
+    token_lists_[key] =
+        base::MakeRefCounted<BlockchainTokenList>(std::move(list));
+  }
 }
 
 void BlockchainRegistry::UpdateTokenList(
     const std::string key,
     std::vector<mojom::BlockchainTokenPtr> list) {
-  token_list_map_[key] = std::move(list);
+  token_lists_[key] = base::MakeRefCounted<BlockchainTokenList>(std::move(list));
 }
 
 void BlockchainRegistry::UpdateChainList(ChainList chains) {
@@ -60,59 +101,39 @@ mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByAddress(
     const std::string& chain_id,
     mojom::CoinType coin,
     const std::string& address) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key))
+  auto token_list = GetTokenList(chain_id, coin);
+  if (!token_list)
     return nullptr;
 
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->contract_address == address;
-      });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  const auto* token = token_list->FindByAddress(address);
+  return token ? token->Clone() : nullptr;
+}
+
+scoped_refptr<const BlockchainTokenList> BlockchainRegistry::GetTokenList(
+    const std::string& chain_id,
+    mojom::CoinType coin) {
+  auto it = token_lists_.find(GetTokenListKey(coin, chain_id));
+  return it == token_lists_.end() ? nullptr : it->second;
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
                                           mojom::CoinType coin,
                                           const std::string& symbol,
                                           GetTokenBySymbolCallback callback) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->symbol == symbol;
-      });
-
-  if (token_it == tokens.end()) {
-    std::move(callback).Run(nullptr);
-    return;
-  }
-
-  std::move(callback).Run(token_it->Clone());
+  auto token_list = GetTokenList(chain_id, coin);
+  const auto* token = token_list ? token_list->FindBySymbol(symbol) : nullptr;
+  std::move(callback).Run(token ? token->Clone() : nullptr);
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
                                       mojom::CoinType coin,
                                       GetAllTokensCallback callback) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
-    std::move(callback).Run(
-        std::vector<brave_wallet::mojom::BlockchainTokenPtr>());
-    return;
+  std::vector<brave_wallet::mojom::BlockchainTokenPtr> tokens_copy;
+  if (auto token_list = GetTokenList(chain_id, coin)) {
+    tokens_copy.reserve(token_list->tokens().size());
+    for (const auto& token : token_list->tokens())
+      tokens_copy.push_back(token.Clone());
   }
-  const auto& tokens = token_list_map_[key];
-  std::vector<brave_wallet::mojom::BlockchainTokenPtr> tokens_copy(
-      tokens.size());
-  std::transform(
-      tokens.begin(), tokens.end(), tokens_copy.begin(),
-      [](const brave_wallet::mojom::BlockchainTokenPtr& current_token)
-          -> brave_wallet::mojom::BlockchainTokenPtr {
-        return current_token.Clone();
-      });
   std::move(callback).Run(std::move(tokens_copy));
 }
 
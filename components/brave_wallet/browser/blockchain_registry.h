@@ -7,8 +7,11 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/singleton.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -19,6 +22,36 @@
 
 namespace brave_wallet {
 
+// Immutable token list of a single chain, indexed by contract address and by
+// symbol when it is built. Instances are shared by reference so lookups and
+// iteration don't need to copy the list.
+class BlockchainTokenList
+    : public base::RefCountedThreadSafe<BlockchainTokenList> {
+ public:
+  explicit BlockchainTokenList(std::vector<mojom::BlockchainTokenPtr> tokens);
+  BlockchainTokenList(const BlockchainTokenList&) = delete;
+  BlockchainTokenList& operator=(const BlockchainTokenList&) = delete;
+
+  const std::vector<mojom::BlockchainTokenPtr>& tokens() const {
+    return tokens_;
+  }
+
+  // Hex (0x prefixed) addresses are matched case-insensitively, other
+  // addresses (e.g. base58 Solana mints) must match exactly. Returns the first
+  // matching token or nullptr.
+  const mojom::BlockchainToken* FindByAddress(
+      const std::string& contract_address) const;
+  const mojom::BlockchainToken* FindBySymbol(const std::string& symbol) const;
+
+ private:
+  friend class base::RefCountedThreadSafe<BlockchainTokenList>;
+  ~BlockchainTokenList();
+
+  const std::vector<mojom::BlockchainTokenPtr> tokens_;
+  std::unordered_map<std::string, size_t> address_index_;
+  std::unordered_map<std::string, size_t> symbol_index_;
+};
+
 class BlockchainRegistry : public mojom::BlockchainRegistry {
  public:
   BlockchainRegistry(const BlockchainRegistry&) = delete;
@@ -37,6 +70,10 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   mojom::BlockchainTokenPtr GetTokenByAddress(const std::string& chain_id,
                                               mojom::CoinType coin,
                                               const std::string& address);
+  // Returns the shared token list of the chain, or nullptr if there is none.
+  scoped_refptr<const BlockchainTokenList> GetTokenList(
+      const std::string& chain_id,
+      mojom::CoinType coin);
   std::vector<mojom::NetworkInfoPtr> GetPrepopulatedNetworks();
 
   // BlockchainRegistry interface methods
@@ -65,10 +102,8 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
       GetPrepopulatedNetworksCallback callback) override;
 
  protected:
-  std::vector<mojom::BlockchainTokenPtr>* GetTokenListFromChainId(
-      const std::string& chain_id);
-
-  TokenListMap token_list_map_;
+  base::flat_map<std::string, scoped_refptr<const BlockchainTokenList>>
+      token_lists_;
   ChainList chain_list_;
   friend struct base::DefaultSingletonTraits<BlockchainRegistry>;
 
@@ -0,0 +1,135 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
+#include "brave/components/brave_wallet/browser/blockchain_registry.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+// npm run test -- brave_perftests --filter=BlockchainRegistryPerfTest.*
+
+namespace brave_wallet {
+
+namespace {
+
+// Roughly the size of the mainnet token list shipped by the wallet data files
+// component.
+constexpr int kTokenCount = 10000;
+constexpr int kLookupCount = 500;
+constexpr int kWarmupRuns = 3;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 1;
+
+// Mixed case hex so that the addresses look like checksum addresses.
+std::string MakeAddress(int index) {
+  std::string address = base::StringPrintf("0x%040x", index * 2654435761u);
+  for (size_t i = 2; i < address.size(); i += 3)
+    address[i] = base::ToUpperASCII(address[i]);
+  return address;
+}
+
+std::vector<mojom::BlockchainTokenPtr> CreateMainnetTokenList() {
+  std::vector<mojom::BlockchainTokenPtr> tokens;
+  for (int i = 0; i < kTokenCount; i++) {
+    const std::string symbol = base::StringPrintf("TKN%d", i);
+    tokens.push_back(mojom::BlockchainToken::New(
+        MakeAddress(i), "Token " + symbol, symbol + ".png", true, false, false,
+        symbol, 18, true, "", "", mojom::kMainnetChainId,
+        mojom::CoinType::ETH));
+  }
+  return tokens;
+}
+
+// Providers return lowercase addresses, half of them unknown to the registry.
+std::vector<std::string> CreateLookupAddresses() {
+  std::vector<std::string> addresses;
+  for (int i = 0; i < kLookupCount; i++) {
+    const int index =
+        i % 2 ? kTokenCount + i : i * (kTokenCount / kLookupCount);
+    addresses.push_back(base::ToLowerASCII(MakeAddress(index)));
+  }
+  return addresses;
+}
+
+}  // namespace
+
+class BlockchainRegistryPerfTest : public testing::Test {
+ protected:
+  BlockchainRegistryPerfTest() : lookup_addresses_(CreateLookupAddresses()) {
+    BlockchainRegistry::GetInstance()->UpdateTokenList(
+        GetTokenListKey(mojom::CoinType::ETH, mojom::kMainnetChainId),
+        CreateMainnetTokenList());
+  }
+
+  void Report(const std::string& story, const base::LapTimer& timer) {
+    perf_test::PerfResultReporter reporter("BlockchainRegistry", story);
+    reporter.RegisterImportantMetric(".lookup", "us");
+    reporter.AddResult(".lookup", timer.TimePerLap().InMicrosecondsF());
+  }
+
+  const std::vector<std::string> lookup_addresses_;
+};
+
+TEST_F(BlockchainRegistryPerfTest, BuildIndex) {
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    BlockchainRegistry::GetInstance()->UpdateTokenList(
+        GetTokenListKey(mojom::CoinType::ETH, mojom::kMainnetChainId),
+        CreateMainnetTokenList());
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+  Report("build_index", timer);
+}
+
+TEST_F(BlockchainRegistryPerfTest, LookupAddresses) {
+  auto* registry = BlockchainRegistry::GetInstance();
+  auto token_list =
+      registry->GetTokenList(mojom::kMainnetChainId, mojom::CoinType::ETH);
+  ASSERT_TRUE(token_list);
+
+  // What callers had to do before the registry was indexed: a linear,
+  // case-insensitive scan of a copy of the whole list per address.
+  base::LapTimer linear_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    std::vector<mojom::BlockchainTokenPtr> tokens_copy;
+    for (const auto& token : token_list->tokens())
+      tokens_copy.push_back(token.Clone());
+    size_t found = 0;
+    for (const auto& address : lookup_addresses_) {
+      auto it = base::ranges::find_if(
+          tokens_copy, [&](const mojom::BlockchainTokenPtr& token) {
+            return base::EqualsCaseInsensitiveASCII(token->contract_address,
+                                                    address);
+          });
+      if (it != tokens_copy.end())
+        found++;
+    }
+    ASSERT_EQ(found, static_cast<size_t>(kLookupCount / 2));
+    linear_timer.NextLap();
+  } while (!linear_timer.HasTimeLimitExpired());
+  Report("linear_scan", linear_timer);
+
+  base::LapTimer indexed_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    size_t found = 0;
+    for (const auto& address : lookup_addresses_) {
+      if (token_list->FindByAddress(address))
+        found++;
+    }
+    ASSERT_EQ(found, static_cast<size_t>(kLookupCount / 2));
+    indexed_timer.NextLap();
+  } while (!indexed_timer.HasTimeLimitExpired());
+  Report("indexed", indexed_timer);
+}
+
+}  // namespace brave_wallet
@@ -404,6 +404,72 @@ TEST(BlockchainRegistryUnitTest, GetTokenBySymbol) {
   run_loop5.Run();
 }
 
+TEST(BlockchainRegistryUnitTest, GetTokenByAddressIgnoresHexCase) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+  TokenListMap token_list_map;
+  ASSERT_TRUE(
+      ParseTokenList(token_list_json, &token_list_map, mojom::CoinType::ETH));
+  ASSERT_TRUE(ParseTokenList(solana_token_list_json, &token_list_map,
+                             mojom::CoinType::SOL));
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  auto token = registry->GetTokenByAddress(
+      mojom::kMainnetChainId, mojom::CoinType::ETH,
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "BAT");
+  // The registry keeps the checksum address.
+  EXPECT_EQ(token->contract_address,
+            "0x0D8775F648430679A709E98d2b0Cb6250d2887EF");
+
+  token = registry->GetTokenByAddress(
+      mojom::kMainnetChainId, mojom::CoinType::ETH,
+      "0X0D8775F648430679A709E98D2B0CB6250D2887EF");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "BAT");
+
+  // Base58 addresses are case sensitive.
+  EXPECT_EQ(registry->GetTokenByAddress(
+                mojom::kSolanaMainnet, mojom::CoinType::SOL,
+                "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v"),
+            usdc);
+  EXPECT_FALSE(registry->GetTokenByAddress(
+      mojom::kSolanaMainnet, mojom::CoinType::SOL,
+      "epjfwdd5aufqssqem2qn1xzybapc8g4weggkzwytdt1v"));
+}
+
+TEST(BlockchainRegistryUnitTest, TokenListIsShared) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+  TokenListMap token_list_map;
+  ASSERT_TRUE(
+      ParseTokenList(token_list_json, &token_list_map, mojom::CoinType::ETH));
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  auto token_list =
+      registry->GetTokenList(mojom::kMainnetChainId, mojom::CoinType::ETH);
+  ASSERT_TRUE(token_list);
+  EXPECT_EQ(token_list, registry->GetTokenList(mojom::kMainnetChainId,
+                                               mojom::CoinType::ETH));
+  EXPECT_EQ(token_list->tokens().size(), 2u);
+  EXPECT_FALSE(
+      registry->GetTokenList(mojom::kSolanaMainnet, mojom::CoinType::SOL));
+
+  // Replacing the registry lists leaves the old list intact for holders.
+  registry->UpdateTokenList(
+      GetTokenListKey(mojom::CoinType::ETH, mojom::kMainnetChainId), {});
+  EXPECT_EQ(token_list->tokens().size(), 2u);
+  const auto* token = token_list->FindBySymbol("BAT");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token, token_list->FindByAddress(
+                       "0x0d8775f648430679a709e98d2b0cb6250d2887ef"));
+  EXPECT_TRUE(registry
+                  ->GetTokenList(mojom::kMainnetChainId, mojom::CoinType::ETH)
+                  ->tokens()
+                  .empty());
+}
+
 TEST(BlockchainRegistryUnitTest, GetBuyTokens) {
   base::test::TaskEnvironment task_environment;
   auto* registry = BlockchainRegistry::GetInstance();
@@ -0,0 +1,103 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_DECENTRALIZED_DNS_RESOLVE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_DECENTRALIZED_DNS_RESOLVE_CACHE_H_
+
+#include <string>
+#include <utility>
+
+#include "base/containers/flat_map.h"
+#include "base/time/time.h"
+
+namespace brave_wallet {
+
+// Remembers the outcome of resolving a decentralized domain (ENS content
+// hash, SNS or Unstoppable Domains URL) so that repeated navigations don't
+// repeat the RPC round-trips. Names with a record are kept for
+// |resolved_ttl|, names without one for |unresolved_ttl|. Callers must not
+// add transient errors, they are retried on the next lookup.
+template <class ResultType, class ErrorType>
+class DecentralizedDnsResolveCache {
+ public:
+  struct Entry {
+    ResultType result;
+    ErrorType error;
+    std::string error_message;
+  };
+
+  static constexpr size_t kMaxEntries = 256;
+
+  DecentralizedDnsResolveCache(base::TimeDelta resolved_ttl,
+                               base::TimeDelta unresolved_ttl)
+      : resolved_ttl_(resolved_ttl), unresolved_ttl_(unresolved_ttl) {}
+  DecentralizedDnsResolveCache(const DecentralizedDnsResolveCache&) = delete;
+  DecentralizedDnsResolveCache& operator=(const DecentralizedDnsResolveCache&) =
+      delete;
+  ~DecentralizedDnsResolveCache() = default;
+
+  // Returns the unexpired entry for |domain|, or nullptr.
+  const Entry* Get(const std::string& domain) {
+    auto it = entries_.find(domain);
+    if (it == entries_.end())
+      return nullptr;
+    if (it->second.expiration <= base::TimeTicks::Now()) {
+      entries_.erase(it);
+      return nullptr;
+    }
+    return &it->second.entry;
+  }
+
+  void SetResolved(const std::string& domain, ResultType result) {
+    Add(domain, {std::move(result), ErrorType::kSuccess, ""}, resolved_ttl_);
+  }
+
+  void SetUnresolved(const std::string& domain,
+                     ErrorType error,
+                     std::string error_message) {
+    Add(domain, {ResultType(), error, std::move(error_message)},
+        unresolved_ttl_);
+  }
+
+  void Clear() { entries_.clear(); }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct CachedEntry {
+    Entry entry;
+    base::TimeTicks expiration;
+  };
+
+  void Add(const std::string& domain, Entry entry, base::TimeDelta ttl) {
+    if (ttl.is_zero())
+      return;
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (entries_.size() >= kMaxEntries && !entries_.contains(domain)) {
+      base::EraseIf(entries_, [now](const auto& item) {
+        return item.second.expiration <= now;
+      });
+    }
+    if (entries_.size() >= kMaxEntries && !entries_.contains(domain)) {
+      // Evict the entry that would expire first.
+      auto oldest = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.expiration < oldest->second.expiration)
+          oldest = it;
+      }
+      entries_.erase(oldest);
+    }
+    entries_[domain] = {std::move(entry), now + ttl};
+  }
+
+  const base::TimeDelta resolved_ttl_;
+  const base::TimeDelta unresolved_ttl_;
+  base::flat_map<std::string, CachedEntry> entries_;
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_DECENTRALIZED_DNS_RESOLVE_CACHE_H_
@@ -0,0 +1,88 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/decentralized_dns_resolve_cache.h"
+
+#include <string>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave_wallet {
+
+namespace {
+
+using ResolveCache = DecentralizedDnsResolveCache<GURL, mojom::ProviderError>;
+
+}  // namespace
+
+class DecentralizedDnsResolveCacheUnitTest : public testing::Test {
+ protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+};
+
+TEST_F(DecentralizedDnsResolveCacheUnitTest, ResolvedAndUnresolved) {
+  ResolveCache cache(base::Minutes(10), base::Minutes(1));
+  EXPECT_FALSE(cache.Get("brave.crypto"));
+
+  cache.SetResolved("brave.crypto", GURL("https://brave.com"));
+  cache.SetUnresolved("unknown.crypto", mojom::ProviderError::kInvalidParams,
+                      "invalid");
+
+  const auto* entry = cache.Get("brave.crypto");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->result, GURL("https://brave.com"));
+  EXPECT_EQ(entry->error, mojom::ProviderError::kSuccess);
+  EXPECT_EQ(entry->error_message, "");
+
+  entry = cache.Get("unknown.crypto");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->result, GURL());
+  EXPECT_EQ(entry->error, mojom::ProviderError::kInvalidParams);
+  EXPECT_EQ(entry->error_message, "invalid");
+
+  // Unresolved names expire first.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_TRUE(cache.Get("brave.crypto"));
+  EXPECT_FALSE(cache.Get("unknown.crypto"));
+
+  task_environment_.FastForwardBy(base::Minutes(9));
+  EXPECT_FALSE(cache.Get("brave.crypto"));
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(DecentralizedDnsResolveCacheUnitTest, ZeroTtlDisablesCaching) {
+  ResolveCache cache(base::Minutes(10), base::TimeDelta());
+  cache.SetUnresolved("unknown.crypto", mojom::ProviderError::kSuccess, "");
+  EXPECT_FALSE(cache.Get("unknown.crypto"));
+
+  cache.SetResolved("brave.crypto", GURL("https://brave.com"));
+  EXPECT_TRUE(cache.Get("brave.crypto"));
+  cache.Clear();
+  EXPECT_FALSE(cache.Get("brave.crypto"));
+}
+
+TEST_F(DecentralizedDnsResolveCacheUnitTest, EvictsFirstToExpire) {
+  ResolveCache cache(base::Minutes(10), base::Minutes(1));
+  cache.SetResolved("first.crypto", GURL("https://first.com"));
+  task_environment_.FastForwardBy(base::Seconds(1));
+  for (size_t i = 1; i < ResolveCache::kMaxEntries; ++i) {
+    cache.SetResolved(base::NumberToString(i) + ".crypto",
+                      GURL("https://brave.com"));
+  }
+  EXPECT_EQ(cache.size(), ResolveCache::kMaxEntries);
+
+  cache.SetResolved("last.crypto", GURL("https://last.com"));
+  EXPECT_EQ(cache.size(), ResolveCache::kMaxEntries);
+  EXPECT_FALSE(cache.Get("first.crypto"));
+  EXPECT_TRUE(cache.Get("last.crypto"));
+  EXPECT_TRUE(cache.Get("1.crypto"));
+}
+
+}  // namespace brave_wallet
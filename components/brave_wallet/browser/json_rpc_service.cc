@@ -15,8 +15,11 @@
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
 #include "base/notreached.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/components/brave_wallet/browser/blockchain_registry.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
@@ -141,6 +144,23 @@ void SetEnsOffchainPref(PrefService* local_state_prefs, bool enabled) {
                                  : EnsOffchainResolveMethod::kDisabled);
 }
 
+bool DecentralizedDnsCacheEnabled() {
+  return base::FeatureList::IsEnabled(
+      brave_wallet::features::kBraveWalletDecentralizedDnsCacheFeature);
+}
+
+// Content hashes depend on whether offchain lookups are allowed, so results
+// are cached separately for each offchain resolve method.
+std::string GetEnsContentHashCacheKey(PrefService* local_state_prefs,
+                                      const std::string& domain) {
+  if (!local_state_prefs)
+    return domain;
+  const auto method =
+      decentralized_dns::GetEnsOffchainResolveMethod(local_state_prefs);
+  return base::StrCat(
+      {domain, "/", base::NumberToString(static_cast<int>(method))});
+}
+
 namespace solana {
 // https://github.com/solana-labs/solana/blob/f7b2951c79cd07685ed62717e78ab1c200924924/rpc/src/rpc.rs#L1717
 constexpr char kAccountNotCreatedError[] = "could not find account";
@@ -156,6 +176,15 @@ JsonRpcService::JsonRpcService(
     PrefService* local_state_prefs)
     : api_request_helper_(new APIRequestHelper(GetNetworkTrafficAnnotationTag(),
                                                url_loader_factory)),
+      ud_resolve_dns_cache_(
+          features::kDecentralizedDnsCacheResolvedTtl.Get(),
+          features::kDecentralizedDnsCacheUnresolvedTtl.Get()),
+      ens_content_hash_cache_(
+          features::kDecentralizedDnsCacheResolvedTtl.Get(),
+          features::kDecentralizedDnsCacheUnresolvedTtl.Get()),
+      sns_resolve_host_cache_(
+          features::kDecentralizedDnsCacheResolvedTtl.Get(),
+          features::kDecentralizedDnsCacheUnresolvedTtl.Get()),
       prefs_(prefs),
       local_state_prefs_(local_state_prefs),
       weak_ptr_factory_(this) {
@@ -195,6 +224,15 @@ void JsonRpcService::SetAPIRequestHelperForTesting(
     api_request_helper_ens_offchain_ = std::make_unique<APIRequestHelper>(
         GetENSOffchainNetworkTrafficAnnotationTag(), url_loader_factory);
   }
+
+  // Results came from the previous endpoints.
+  ClearDecentralizedDnsResolveCaches();
+}
+
+void JsonRpcService::ClearDecentralizedDnsResolveCaches() {
+  ud_resolve_dns_cache_.Clear();
+  ens_content_hash_cache_.Clear();
+  sns_resolve_host_cache_.Clear();
 }
 
 JsonRpcService::~JsonRpcService() = default;
@@ -1200,6 +1238,20 @@ void JsonRpcService::OnEnsRegistryGetResolver(
 
 void JsonRpcService::EnsGetContentHash(const std::string& domain,
                                        EnsGetContentHashCallback callback) {
+  if (DecentralizedDnsCacheEnabled()) {
+    const std::string cache_key =
+        GetEnsContentHashCacheKey(local_state_prefs_, domain);
+    if (const auto* entry = ens_content_hash_cache_.Get(cache_key)) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback), entry->result, false,
+                                    entry->error, entry->error_message));
+      return;
+    }
+    callback = base::BindOnce(&JsonRpcService::OnEnsGetContentHashDone,
+                              weak_ptr_factory_.GetWeakPtr(), cache_key,
+                              std::move(callback));
+  }
+
   if (EnsL2FeatureEnabled()) {
     if (ens_get_content_hash_tasks_.ContainsTaskForDomain(domain)) {
       ens_get_content_hash_tasks_.AddCallbackForDomain(domain,
@@ -1233,6 +1285,27 @@ void JsonRpcService::EnsGetContentHash(const std::string& domain,
   EnsRegistryGetResolver(domain, std::move(internal_callback));
 }
 
+void JsonRpcService::OnEnsGetContentHashDone(
+    const std::string& cache_key,
+    EnsGetContentHashCallback callback,
+    const std::vector<uint8_t>& content_hash,
+    bool require_offchain_consent,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  // Consent requests and transient errors are not cached.
+  if (!require_offchain_consent) {
+    if (error == mojom::ProviderError::kSuccess && !content_hash.empty()) {
+      ens_content_hash_cache_.SetResolved(cache_key, content_hash);
+    } else if (error == mojom::ProviderError::kSuccess ||
+               error == mojom::ProviderError::kInvalidParams) {
+      ens_content_hash_cache_.SetUnresolved(cache_key, error, error_message);
+    }
+  }
+
+  std::move(callback).Run(content_hash, require_offchain_consent, error,
+                          error_message);
+}
+
 void JsonRpcService::ContinueEnsGetContentHash(
     const std::string& domain,
     EnsGetContentHashCallback callback,
@@ -1448,6 +1521,18 @@ void JsonRpcService::SnsResolveHost(const std::string& domain,
     return;
   }
 
+  if (DecentralizedDnsCacheEnabled()) {
+    if (const auto* entry = sns_resolve_host_cache_.Get(domain)) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback), entry->result,
+                                    entry->error, entry->error_message));
+      return;
+    }
+    callback = base::BindOnce(&JsonRpcService::OnSnsResolveHostDone,
+                              weak_ptr_factory_.GetWeakPtr(), domain,
+                              std::move(callback));
+  }
+
   if (sns_resolve_host_tasks_.ContainsTaskForDomain(domain)) {
     sns_resolve_host_tasks_.AddCallbackForDomain(domain, std::move(callback));
     return;
@@ -1464,6 +1549,21 @@ void JsonRpcService::SnsResolveHost(const std::string& domain,
       std::move(callback));
 }
 
+void JsonRpcService::OnSnsResolveHostDone(
+    const std::string& domain,
+    SnsResolveHostCallback callback,
+    const GURL& url,
+    mojom::SolanaProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::SolanaProviderError::kSuccess && url.is_valid()) {
+    sns_resolve_host_cache_.SetResolved(domain, url);
+  } else if (error == mojom::SolanaProviderError::kInvalidParams) {
+    sns_resolve_host_cache_.SetUnresolved(domain, error, error_message);
+  }
+
+  std::move(callback).Run(url, error, error_message);
+}
+
 void JsonRpcService::OnSnsResolveHostTaskDone(
     SnsResolverTask* task,
     absl::optional<SnsResolverTaskResult> task_result,
@@ -1589,6 +1689,19 @@ void JsonRpcService::OnEnsGetEthAddr(EnsGetEthAddrCallback callback,
 void JsonRpcService::UnstoppableDomainsResolveDns(
     const std::string& domain,
     UnstoppableDomainsResolveDnsCallback callback) {
+  if (DecentralizedDnsCacheEnabled()) {
+    if (const auto* entry = ud_resolve_dns_cache_.Get(domain)) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(std::move(callback), entry->result,
+                                    entry->error, entry->error_message));
+      return;
+    }
+    callback =
+        base::BindOnce(&JsonRpcService::OnUnstoppableDomainsResolveDnsDone,
+                       weak_ptr_factory_.GetWeakPtr(), domain,
+                       std::move(callback));
+  }
+
   if (ud_resolve_dns_calls_.HasCall(domain)) {
     ud_resolve_dns_calls_.AddCallback(domain, std::move(callback));
     return;
@@ -1624,6 +1737,23 @@ void JsonRpcService::UnstoppableDomainsResolveDns(
   }
 }
 
+void JsonRpcService::OnUnstoppableDomainsResolveDnsDone(
+    const std::string& domain,
+    UnstoppableDomainsResolveDnsCallback callback,
+    const GURL& url,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::ProviderError::kSuccess) {
+    if (url.is_valid()) {
+      ud_resolve_dns_cache_.SetResolved(domain, url);
+    } else {
+      ud_resolve_dns_cache_.SetUnresolved(domain, error, error_message);
+    }
+  }
+
+  std::move(callback).Run(url, error, error_message);
+}
+
 void JsonRpcService::OnUnstoppableDomainsResolveDns(
     const std::string& domain,
     const std::string& chain_id,
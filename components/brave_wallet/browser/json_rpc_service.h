@@ -18,6 +18,7 @@
 #include "base/observer_list_threadsafe.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
+#include "brave/components/brave_wallet/browser/decentralized_dns_resolve_cache.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
 #include "brave/components/brave_wallet/browser/nft_metadata_fetcher.h"
 #include "brave/components/brave_wallet/browser/sns_resolver_task.h"
@@ -173,6 +174,12 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const std::string& domain,
       UnstoppableDomainsResolveDnsCallback callback);
 
+  // Drops the results of UnstoppableDomainsResolveDns(), EnsGetContentHash()
+  // and SnsResolveHost(), i.e. when browsing data is cleared. These are only
+  // resolved for regular profiles, because the service is shared with their
+  // off-the-record profiles.
+  void ClearDecentralizedDnsResolveCaches();
+
   void UnstoppableDomainsGetWalletAddr(
       const std::string& domain,
       mojom::BlockchainTokenPtr token,
@@ -453,6 +460,23 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   void OnUnstoppableDomainsResolveDns(const std::string& domain,
                                       const std::string& chain_id,
                                       APIRequestResult api_request_result);
+  void OnUnstoppableDomainsResolveDnsDone(
+      const std::string& domain,
+      UnstoppableDomainsResolveDnsCallback callback,
+      const GURL& url,
+      mojom::ProviderError error,
+      const std::string& error_message);
+  void OnEnsGetContentHashDone(const std::string& cache_key,
+                               EnsGetContentHashCallback callback,
+                               const std::vector<uint8_t>& content_hash,
+                               bool require_offchain_consent,
+                               mojom::ProviderError error,
+                               const std::string& error_message);
+  void OnSnsResolveHostDone(const std::string& domain,
+                            SnsResolveHostCallback callback,
+                            const GURL& url,
+                            mojom::SolanaProviderError error,
+                            const std::string& error_message);
   void OnUnstoppableDomainsGetWalletAddr(
       const unstoppable_domains::WalletAddressKey& key,
       const std::string& chain_id,
@@ -591,6 +615,15 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   SnsResolverTaskContainer<SnsGetSolAddrCallback> sns_get_sol_addr_tasks_;
   SnsResolverTaskContainer<SnsResolveHostCallback> sns_resolve_host_tasks_;
 
+  // Completed decentralized DNS resolutions, see
+  // features::kBraveWalletDecentralizedDnsCacheFeature.
+  DecentralizedDnsResolveCache<GURL, mojom::ProviderError>
+      ud_resolve_dns_cache_;
+  DecentralizedDnsResolveCache<std::vector<uint8_t>, mojom::ProviderError>
+      ens_content_hash_cache_;
+  DecentralizedDnsResolveCache<GURL, mojom::SolanaProviderError>
+      sns_resolve_host_cache_;
+
   mojo::ReceiverSet<mojom::JsonRpcService> receivers_;
   PrefService* prefs_ = nullptr;
   PrefService* local_state_prefs_ = nullptr;
@@ -405,6 +405,9 @@ class SolRpcCallHandler {
   void FailWithTimeout(bool fail_with_timeout = true) {
     fail_with_timeout_ = fail_with_timeout;
   }
+  void FailWithInvalidParams(bool fail_with_invalid_params = true) {
+    fail_with_invalid_params_ = fail_with_invalid_params;
+  }
   void Disable(bool disabled = true) { disabled_ = disabled; }
 
   absl::optional<SolanaAddress> AddressFromParams(
@@ -419,6 +422,7 @@ class SolRpcCallHandler {
 
  protected:
   bool fail_with_timeout_ = false;
+  bool fail_with_invalid_params_ = false;
   bool disabled_ = false;
 };
 
@@ -496,6 +500,12 @@ class GetAccountInfoHandler : public SolRpcCallHandler {
     if (fail_with_timeout_)
       return "timeout";
 
+    if (fail_with_invalid_params_) {
+      return MakeJsonRpcErrorResponse(
+          static_cast<int>(mojom::SolanaProviderError::kInvalidParams),
+          "Invalid params");
+    }
+
     if (!account_address_.IsValid()) {
       return MakeJsonRpcValueResponse(base::Value());
     }
@@ -700,7 +710,12 @@ class JsonRpcEnpointHandler {
 
 class JsonRpcServiceUnitTest : public testing::Test {
  public:
-  JsonRpcServiceUnitTest() = default;
+  JsonRpcServiceUnitTest() {
+    // Tests resolve the same domains with different responses, the cache is
+    // covered by the *_Cache tests.
+    resolve_cache_feature_list_.InitAndDisableFeature(
+        features::kBraveWalletDecentralizedDnsCacheFeature);
+  }
 
   void SetUp() override {
     Test::SetUp();
@@ -1456,6 +1471,7 @@ class JsonRpcServiceUnitTest : public testing::Test {
   network::TestURLLoaderFactory url_loader_factory_;
 
  private:
+  base::test::ScopedFeatureList resolve_cache_feature_list_;
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   sync_preferences::TestingPrefServiceSyncable local_state_prefs_;
@@ -3118,6 +3134,69 @@ TEST_F(UnstoppableDomainsUnitTest, ResolveDns_ManyCalls) {
   testing::Mock::VerifyAndClearExpectations(&callback3);
 }
 
+TEST_F(UnstoppableDomainsUnitTest, ResolveDns_Cache) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletDecentralizedDnsCacheFeature);
+
+  auto& keys = unstoppable_domains::GetRecordKeys();
+  polygon_getmany_call_handler_->AddItem("brave.crypto", keys[5],
+                                         "https://brave.com");
+
+  base::MockCallback<ResolveDnsCallback> callback;
+  EXPECT_CALL(callback, Run(GURL("https://brave.com"),
+                            mojom::ProviderError::kSuccess, ""))
+      .Times(2);
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.crypto",
+                                                  callback.Get());
+  base::RunLoop().RunUntilIdle();
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.crypto",
+                                                  callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+  EXPECT_EQ(1, polygon_getmany_call_handler_->calls_number());
+  EXPECT_EQ(1, eth_mainnet_getmany_call_handler_->calls_number());
+
+  // Clearing browsing data drops the cached results.
+  json_rpc_service_->ClearDecentralizedDnsResolveCaches();
+  EXPECT_CALL(callback, Run(GURL("https://brave.com"),
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.crypto",
+                                                  callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+  EXPECT_EQ(2, polygon_getmany_call_handler_->calls_number());
+  EXPECT_EQ(2, eth_mainnet_getmany_call_handler_->calls_number());
+
+  // Domains without a record are cached too.
+  EXPECT_CALL(callback, Run(GURL(), mojom::ProviderError::kSuccess, ""))
+      .Times(2);
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.x", callback.Get());
+  base::RunLoop().RunUntilIdle();
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.x", callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+  EXPECT_EQ(3, polygon_getmany_call_handler_->calls_number());
+  EXPECT_EQ(3, eth_mainnet_getmany_call_handler_->calls_number());
+
+  // Network errors are retried.
+  SetEthTimeoutResponse();
+  SetPolygonTimeoutResponse();
+  EXPECT_CALL(callback,
+              Run(GURL(), mojom::ProviderError::kInternalError,
+                  l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR)))
+      .Times(2);
+  json_rpc_service_->UnstoppableDomainsResolveDns("brad.crypto",
+                                                  callback.Get());
+  base::RunLoop().RunUntilIdle();
+  json_rpc_service_->UnstoppableDomainsResolveDns("brad.crypto",
+                                                  callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+  EXPECT_EQ(5, polygon_getmany_call_handler_->calls_number());
+  EXPECT_EQ(5, eth_mainnet_getmany_call_handler_->calls_number());
+}
+
 TEST_F(JsonRpcServiceUnitTest, GetIsEip1559) {
   bool callback_called = false;
   GURL expected_network =
@@ -4799,8 +4878,12 @@ class OffchainGatewayHandler {
     return response;
   }
 
-  void SetRespondWith500() { respond_with_500_ = true; }
-  void SetRespondWithNoRecord() { respond_with_no_record_ = true; }
+  void SetRespondWith500(bool respond_with_500 = true) {
+    respond_with_500_ = respond_with_500;
+  }
+  void SetRespondWithNoRecord(bool respond_with_no_record = true) {
+    respond_with_no_record_ = respond_with_no_record;
+  }
 
  private:
   GURL gateway_url_;
@@ -5268,6 +5351,66 @@ TEST_F(ENSL2JsonRpcServiceUnitTest, GetContentHash_GatewayNoRecord) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST_F(ENSL2JsonRpcServiceUnitTest, GetContentHash_Cache) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletDecentralizedDnsCacheFeature);
+
+  decentralized_dns::SetEnsOffchainResolveMethod(
+      local_state_prefs(),
+      decentralized_dns::EnsOffchainResolveMethod::kEnabled);
+
+  // Gateway errors are retried.
+  offchain_gateway_handler_->SetRespondWith500();
+  base::MockCallback<JsonRpcService::EnsGetContentHashCallback> callback;
+  EXPECT_CALL(
+      callback,
+      Run(std::vector<uint8_t>(), false, mojom::ProviderError::kInternalError,
+          l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR)));
+  json_rpc_service_->EnsGetContentHash(ens_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  offchain_gateway_handler_->SetRespondWith500(false);
+  EXPECT_CALL(callback, Run(offchain_contenthash(), false,
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->EnsGetContentHash(ens_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  // Resolved names are served from the cache.
+  offchain_gateway_handler_->SetRespondWith500();
+  EXPECT_CALL(callback, Run(offchain_contenthash(), false,
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->EnsGetContentHash(ens_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  // So are names without a record.
+  offchain_gateway_handler_->SetRespondWith500(false);
+  offchain_gateway_handler_->SetRespondWithNoRecord();
+  EXPECT_CALL(
+      callback,
+      Run(std::vector<uint8_t>(), false, mojom::ProviderError::kInvalidParams,
+          l10n_util::GetStringUTF8(IDS_WALLET_INVALID_PARAMETERS)))
+      .Times(2);
+  json_rpc_service_->EnsGetContentHash(ens_subdomain_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  offchain_gateway_handler_->SetRespondWithNoRecord(false);
+  json_rpc_service_->EnsGetContentHash(ens_subdomain_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  // Swapping the endpoints drops the cached results.
+  json_rpc_service_->SetAPIRequestHelperForTesting(
+      shared_url_loader_factory());
+  EXPECT_CALL(callback, Run(offchain_subdomain_contenthash(), false,
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->EnsGetContentHash(ens_subdomain_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+}
+
 TEST_F(ENSL2JsonRpcServiceUnitTest, GetContentHash_Consent) {
   EXPECT_EQ(
       decentralized_dns::EnsOffchainResolveMethod::kAsk,
@@ -5617,6 +5760,50 @@ TEST_F(SnsJsonRpcServiceUnitTest, ResolveHost_IpfsValue) {
   testing::Mock::VerifyAndClearExpectations(&callback);
 }
 
+TEST_F(SnsJsonRpcServiceUnitTest, ResolveHost_Cache) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletDecentralizedDnsCacheFeature);
+
+  // HTTP errors are retried.
+  url_record_address_handler_->FailWithTimeout();
+  base::MockCallback<JsonRpcService::SnsResolveHostCallback> callback;
+  EXPECT_CALL(callback,
+              Run(GURL(), mojom::SolanaProviderError::kInternalError,
+                  l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR)));
+  json_rpc_service_->SnsResolveHost(sns_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  url_record_address_handler_->FailWithTimeout(false);
+  EXPECT_CALL(callback,
+              Run(url_value(), mojom::SolanaProviderError::kSuccess, ""));
+  json_rpc_service_->SnsResolveHost(sns_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  // Resolved names are served from the cache.
+  url_record_address_handler_->FailWithTimeout();
+  EXPECT_CALL(callback,
+              Run(url_value(), mojom::SolanaProviderError::kSuccess, ""));
+  json_rpc_service_->SnsResolveHost(sns_host(), callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+  url_record_address_handler_->FailWithTimeout(false);
+
+  // So are names rejected as invalid.
+  default_handler_->FailWithInvalidParams();
+  EXPECT_CALL(callback, Run(GURL(), mojom::SolanaProviderError::kInvalidParams,
+                            "Invalid params"))
+      .Times(2);
+  json_rpc_service_->SnsResolveHost("unknown.sol", callback.Get());
+  base::RunLoop().RunUntilIdle();
+  default_handler_->FailWithInvalidParams(false);
+  json_rpc_service_->SnsResolveHost("unknown.sol", callback.Get());
+  base::RunLoop().RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+}
+
 TEST_F(JsonRpcServiceUnitTest, EthGetLogs) {
   base::Value::List contract_addresses;
   base::Value::List topics;
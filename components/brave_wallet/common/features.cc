@@ -50,5 +50,15 @@ BASE_FEATURE(kBraveWalletSnsFeature,
              "BraveWalletSns",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveWalletDecentralizedDnsCacheFeature,
+             "BraveWalletDecentralizedDnsCache",
+             base::FEATURE_ENABLED_BY_DEFAULT);
+const base::FeatureParam<base::TimeDelta> kDecentralizedDnsCacheResolvedTtl{
+    &kBraveWalletDecentralizedDnsCacheFeature, "resolved_ttl",
+    base::Minutes(10)};
+const base::FeatureParam<base::TimeDelta> kDecentralizedDnsCacheUnresolvedTtl{
+    &kBraveWalletDecentralizedDnsCacheFeature, "unresolved_ttl",
+    base::Minutes(1)};
+
 }  // namespace features
 }  // namespace brave_wallet
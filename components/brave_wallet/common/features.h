@@ -20,6 +20,11 @@ BASE_DECLARE_FEATURE(kBraveWalletSolanaProviderFeature);
 BASE_DECLARE_FEATURE(kBraveWalletDappsSupportFeature);
 BASE_DECLARE_FEATURE(kBraveWalletENSL2Feature);
 BASE_DECLARE_FEATURE(kBraveWalletSnsFeature);
+BASE_DECLARE_FEATURE(kBraveWalletDecentralizedDnsCacheFeature);
+extern const base::FeatureParam<base::TimeDelta>
+    kDecentralizedDnsCacheResolvedTtl;
+extern const base::FeatureParam<base::TimeDelta>
+    kDecentralizedDnsCacheUnresolvedTtl;
 
 }  // namespace features
 }  // namespace brave_wallet
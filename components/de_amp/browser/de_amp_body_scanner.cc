@@ -0,0 +1,125 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/de_amp/browser/de_amp_body_scanner.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "base/strings/string_util.h"
+#include "brave/components/de_amp/browser/de_amp_util.h"
+
+namespace de_amp {
+
+namespace {
+
+constexpr char kCommentStart[] = "<!--";
+constexpr char kCommentEnd[] = "-->";
+
+// Whitespace and the UTF-8 byte order mark.
+constexpr char kPrologTextChars[] = " \t\n\v\f\r\xEF\xBB\xBF";
+
+bool IsPrologText(base::StringPiece text) {
+  return base::ContainsOnlyChars(text, kPrologTextChars);
+}
+
+// <!DOCTYPE ...>, <!-- ... --> or <?xml ...?>
+bool IsPrologTag(base::StringPiece tag) {
+  return tag.size() > 1 && (tag[1] == '!' || tag[1] == '?');
+}
+
+}  // namespace
+
+DeAmpBodyScanner::DeAmpBodyScanner() = default;
+
+DeAmpBodyScanner::~DeAmpBodyScanner() = default;
+
+DeAmpBodyScanner::Result DeAmpBodyScanner::Scan(base::StringPiece body) {
+  DCHECK_LE(tag_end_search_offset_, body.size());
+
+  // None of the patterns we look for can contain '>' before the end of the
+  // tag, so every match lies inside one "<...>" span and the body can be
+  // examined one span at a time. Comments may contain '>' and run until the
+  // next "-->" instead.
+  while (true) {
+    if (tag_end_search_offset_ == tag_start_) {
+      const size_t tag_start = body.find('<', tag_start_);
+      const size_t text_end =
+          tag_start == base::StringPiece::npos ? body.size() : tag_start;
+      if (!found_html_tag_ &&
+          !IsPrologText(body.substr(tag_start_, text_end - tag_start_))) {
+        return Result::kNotAmp;
+      }
+      tag_start_ = tag_end_search_offset_ = text_end;
+      if (tag_start == base::StringPiece::npos) {
+        break;
+      }
+      tag_end_search_offset_ = tag_start + 1;
+    }
+
+    const base::StringPiece tag_head = body.substr(tag_start_);
+    if (tag_head.size() < sizeof(kCommentStart) - 1 &&
+        base::StartsWith(kCommentStart, tag_head)) {
+      // Can't tell a comment from a doctype yet.
+      break;
+    }
+
+    size_t tag_end = base::StringPiece::npos;
+    if (base::StartsWith(tag_head, kCommentStart)) {
+      const size_t search_offset = std::max(
+          tag_end_search_offset_, tag_start_ + sizeof(kCommentStart) - 1);
+      tag_end = body.find(kCommentEnd, search_offset);
+      if (tag_end == base::StringPiece::npos) {
+        // Comment is cut off, resume where a split "-->" could start.
+        tag_end_search_offset_ = std::max(
+            search_offset, body.size() - (sizeof(kCommentEnd) - 2));
+        break;
+      }
+      tag_end += sizeof(kCommentEnd) - 2;
+    } else {
+      tag_end = body.find('>', tag_end_search_offset_);
+      if (tag_end == base::StringPiece::npos) {
+        // Tag is cut off, wait for the rest of it.
+        tag_end_search_offset_ = body.size();
+        break;
+      }
+    }
+
+    const base::StringPiece tag =
+        body.substr(tag_start_, tag_end - tag_start_ + 1);
+    tag_start_ = tag_end_search_offset_ = tag_end + 1;
+
+    if (!found_html_tag_) {
+      auto html_tag = FindHtmlTag(tag);
+      if (!html_tag) {
+        // Only a doctype or comments may come before <html>.
+        if (!IsPrologTag(tag)) {
+          return Result::kNotAmp;
+        }
+        continue;
+      }
+      found_html_tag_ = true;
+      is_amp_ = IsAmpHtmlTag(*html_tag);
+      if (!is_amp_) {
+        return Result::kNotAmp;
+      }
+      continue;
+    }
+
+    if (IsPrologTag(tag)) {
+      continue;
+    }
+
+    if (auto link_tag = FindCanonicalLinkTag(tag)) {
+      canonical_url_ = GetCanonicalHref(*link_tag);
+      return canonical_url_ ? Result::kCanonicalUrlFound
+                            : Result::kCanonicalUrlNotFound;
+    }
+  }
+
+  return Result::kNeedMoreData;
+}
+
+}  // namespace de_amp
@@ -0,0 +1,60 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_BODY_SCANNER_H_
+#define BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_BODY_SCANNER_H_
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace de_amp {
+
+// Resumable AMP detector for a response body that arrives in chunks.
+// Each call to Scan() receives the whole body buffered so far and only looks
+// at the bytes appended since the previous call, tag by tag, so slow
+// connections that deliver many small chunks are not rescanned from the
+// start every time.
+class DeAmpBodyScanner {
+ public:
+  enum class Result {
+    // Not decided yet, call Scan() again once more of the body is available.
+    kNeedMoreData,
+    // Not an AMP page, or something other than a doctype, comments or
+    // whitespace came before the <html> tag. The body can be released right
+    // away.
+    kNotAmp,
+    // AMP page with a canonical link, see canonical_url().
+    kCanonicalUrlFound,
+    // AMP page whose canonical <link> tag has no usable href.
+    kCanonicalUrlNotFound,
+  };
+
+  DeAmpBodyScanner();
+  ~DeAmpBodyScanner();
+  DeAmpBodyScanner(const DeAmpBodyScanner&) = delete;
+  DeAmpBodyScanner& operator=(const DeAmpBodyScanner&) = delete;
+
+  // |body| must start with the same bytes that were passed previously.
+  Result Scan(base::StringPiece body);
+
+  bool is_amp() const { return is_amp_; }
+  const std::string& canonical_url() const { return *canonical_url_; }
+
+ private:
+  // Start of the first tag which hasn't been examined yet.
+  size_t tag_start_ = 0;
+  // Where to resume looking for the '>' or "-->" that ends a tag cut off at
+  // the end of the body.
+  size_t tag_end_search_offset_ = 0;
+  bool found_html_tag_ = false;
+  bool is_amp_ = false;
+  absl::optional<std::string> canonical_url_;
+};
+
+}  // namespace de_amp
+
+#endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_BODY_SCANNER_H_
@@ -71,58 +71,44 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
   if (!CheckBufferedBody(kMaxBytesToCheck - buffered_body_.size())) {
     return;
   }
-  if (MaybeRedirectToCanonicalLink()) {
+  const auto result = scanner_.Scan(buffered_body_);
+  if (result == DeAmpBodyScanner::Result::kCanonicalUrlFound &&
+      MaybeRedirectToCanonicalLink(GURL(scanner_.canonical_url()))) {
     // Only abort if we know we're successfully going to the canonical URL
     Abort();
     return;
   }
-  // If we were not redirected and we didn't find AMP, or
-  // if we did find AMP previously and we've already read more bytes than
-  // max, complete the load.
-  if (!found_amp_ || read_bytes_ >= kMaxBytesToCheck) {
-    found_amp_ = false;  // reset
+  if (result == DeAmpBodyScanner::Result::kCanonicalUrlNotFound) {
+    VLOG(2) << __func__ << " couldn't find canonical URL in link tag";
+  }
+  // Complete the load unless we found AMP and are still looking for the
+  // canonical link within the first max bytes.
+  if (result != DeAmpBodyScanner::Result::kNeedMoreData ||
+      read_bytes_ >= kMaxBytesToCheck) {
     CompleteLoading(std::move(buffered_body_));
     return;
   }
   body_consumer_watcher_.ArmOrNotify();
 }
 
-bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
+bool DeAmpURLLoader::MaybeRedirectToCanonicalLink(const GURL& canonical_url) {
   if (!de_amp_throttle_) {
     return false;
   }
 
-  // If we are not already on an AMP page, check if this chunk has the AMP HTML
-  if (!found_amp_ && !CheckIfAmpPage(buffered_body_)) {
-    return false;
-  }
-
-  found_amp_ = true;  // If we get to this point, we know we have an AMP page
-
-  auto canonical_link = FindCanonicalAmpUrl(buffered_body_);
-  if (!canonical_link.has_value()) {
-    VLOG(2) << __func__ << canonical_link.error();
-    return false;
-  }
-
-  bool redirected = false;
-  const GURL canonical_url(canonical_link.value());
   // Validate the found canonical AMP URL
-  if (VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
-    // Attempt to go to the canonical URL
-    VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
-    if (de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
-      redirected = true;
-    } else {
-      VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
-    }
-  } else {
+  if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
     VLOG(2) << __func__ << " canonical link verification failed "
             << canonical_url;
+    return false;
+  }
+  // Attempt to go to the canonical URL
+  VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
+  if (!de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
+    VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
+    return false;
   }
-  // At this point we've either redirected, or we should stop trying
-  found_amp_ = false;
-  return redirected;
+  return true;
 }
 
 void DeAmpURLLoader::OnBodyWritable(MojoResult r) {
@@ -13,6 +13,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
+#include "brave/components/de_amp/browser/de_amp_body_scanner.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
@@ -44,11 +45,11 @@ class DeAmpURLLoader : public body_sniffer::BodySnifferURLLoader {
                  scoped_refptr<base::SequencedTaskRunner> task_runner);
   void OnBodyReadable(MojoResult) override;
   void OnBodyWritable(MojoResult) override;
-  bool MaybeRedirectToCanonicalLink();
+  bool MaybeRedirectToCanonicalLink(const GURL& canonical_url);
   void ForwardBodyToClient();
 
   base::WeakPtr<DeAmpThrottle> de_amp_throttle_;
-  bool found_amp_ = false;
+  DeAmpBodyScanner scanner_;
 };
 
 }  // namespace de_amp
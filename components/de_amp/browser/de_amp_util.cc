@@ -39,6 +39,10 @@ RE2::Options InitRegexOptions() {
   return opt;
 }
 
+re2::StringPiece ToRE2StringPiece(base::StringPiece text) {
+  return re2::StringPiece(text.data(), text.size());
+}
+
 }  // namespace
 
 bool IsDeAmpEnabled(PrefService* prefs) {
@@ -54,50 +58,72 @@ bool VerifyCanonicalAmpUrl(const GURL& canonical_link,
          canonical_link != original_url;
 }
 
+absl::optional<base::StringPiece> FindHtmlTag(base::StringPiece text) {
+  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(
+      kGetHtmlTagPattern, InitRegexOptions());
+  re2::StringPiece html_tag;
+  if (!RE2::PartialMatch(ToRE2StringPiece(text), *kGetHtmlTagRegex,
+                         &html_tag)) {
+    return absl::nullopt;
+  }
+  return base::StringPiece(html_tag.data(), html_tag.size());
+}
+
+bool IsAmpHtmlTag(base::StringPiece html_tag) {
+  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
+                                                            InitRegexOptions());
+  return RE2::PartialMatch(ToRE2StringPiece(html_tag), *kDetectAmpRegex);
+}
+
+absl::optional<base::StringPiece> FindCanonicalLinkTag(base::StringPiece text) {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
+      kFindCanonicalLinkTagPattern, InitRegexOptions());
+  re2::StringPiece link_tag;
+  if (!RE2::PartialMatch(ToRE2StringPiece(text), *kFindCanonicalLinkTagRegex,
+                         &link_tag)) {
+    return absl::nullopt;
+  }
+  return base::StringPiece(link_tag.data(), link_tag.size());
+}
+
+absl::optional<std::string> GetCanonicalHref(base::StringPiece link_tag) {
+  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
+      kFindCanonicalHrefInTagPattern, InitRegexOptions());
+  std::string canonical_url;
+  // Check there is only 1 href captured, else fail
+  if (!RE2::PartialMatch(ToRE2StringPiece(link_tag),
+                         *kFindCanonicalHrefInTagRegex, &canonical_url)) {
+    return absl::nullopt;
+  }
+  return canonical_url;
+}
+
 bool CheckIfAmpPage(const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important:
   // we first get the relevant HTML tag and then find the info.
-  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(kGetHtmlTagPattern,
-                                                             opt);
-  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
-                                                            opt);
-
-  std::string html_tag;
-  if (!RE2::PartialMatch(body, *kGetHtmlTagRegex, &html_tag)) {
+  auto html_tag = FindHtmlTag(body);
+  if (!html_tag) {
     // Early exit if we can't find HTML tag - malformed document (or error)
     return false;
   }
-  if (!RE2::PartialMatch(html_tag, *kDetectAmpRegex)) {
-    // Not AMP
-    return false;
-  }
-  return true;
+  return IsAmpHtmlTag(*html_tag);
 }
 
 base::expected<std::string, std::string> FindCanonicalAmpUrl(
     const std::string& body) {
-  auto opt = InitRegexOptions();
   // The order of running these regexes is important
-  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
-      kFindCanonicalLinkTagPattern, opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
-      kFindCanonicalHrefInTagPattern, opt);
-
-  std::string link_tag;
-  if (!RE2::PartialMatch(body, *kFindCanonicalLinkTagRegex, &link_tag)) {
+  auto link_tag = FindCanonicalLinkTag(body);
+  if (!link_tag) {
     // Can't find link tag, exit
     return base::unexpected("Couldn't find link tag");
   }
-  std::string canonical_url;
   // Find href in canonical link tag
-  // Check there is only 1 href captured, else fail
-  if (!RE2::PartialMatch(link_tag, *kFindCanonicalHrefInTagRegex,
-                         &canonical_url)) {
+  auto canonical_url = GetCanonicalHref(*link_tag);
+  if (!canonical_url) {
     // Didn't find canonical link, potentially try again
     return base::unexpected("Couldn't find canonical URL in link tag");
   }
-  return base::ok(std::move(canonical_url));
+  return base::ok(std::move(*canonical_url));
 }
 
 }  // namespace de_amp
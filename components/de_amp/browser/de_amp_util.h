@@ -8,8 +8,10 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
 #include "base/types/expected.h"
 #include "components/prefs/pref_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace de_amp {
@@ -24,6 +26,18 @@ bool CheckIfAmpPage(const std::string& body);
 base::expected<std::string, std::string> FindCanonicalAmpUrl(
     const std::string& body);
 
+// Find the first <html> tag in text
+absl::optional<base::StringPiece> FindHtmlTag(base::StringPiece text);
+
+// Check if an <html> tag carries the AMP attribute
+bool IsAmpHtmlTag(base::StringPiece html_tag);
+
+// Find the first canonical <link> tag in text
+absl::optional<base::StringPiece> FindCanonicalLinkTag(base::StringPiece text);
+
+// Get href out of a canonical <link> tag
+absl::optional<std::string> GetCanonicalHref(base::StringPiece link_tag);
+
 // Validation check for canonical URL
 bool VerifyCanonicalAmpUrl(const GURL& canonical_url, const GURL& original_url);
 }  // namespace de_amp
@@ -0,0 +1,114 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/de_amp/browser/de_amp_body_scanner.h"
+#include "brave/components/de_amp/browser/de_amp_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace de_amp {
+
+namespace {
+
+constexpr size_t kChunkSize = 1024;
+constexpr int kWarmupRuns = 5;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 10;
+
+// Roughly the shape of a news article served from an AMP cache: boilerplate,
+// a long list of custom element scripts and a big amp-custom stylesheet, with
+// the canonical link near the end of <head>.
+std::string BuildAmpPage(bool is_amp) {
+  std::string page = "<!doctype html>\n";
+  page += is_amp ? "<html ⚡ lang=\"en\">\n" : "<html lang=\"en\">\n";
+  page +=
+      "<head>\n<meta charset=\"utf-8\">\n"
+      "<meta name=\"viewport\" content=\"width=device-width\">\n"
+      "<script async src=\"https://cdn.ampproject.org/v0.js\"></script>\n";
+  for (int i = 0; i < 40; ++i) {
+    base::StringAppendF(&page,
+                        "<script async custom-element=\"amp-element-%d\" "
+                        "src=\"https://cdn.ampproject.org/v0/amp-%d.js\">"
+                        "</script>\n",
+                        i, i);
+  }
+  page += "<style amp-custom>\n";
+  for (int i = 0; i < 1500; ++i) {
+    base::StringAppendF(&page,
+                        ".article-body .c%d{margin:0 auto;padding:%dpx;"
+                        "font-size:%dpx}\n",
+                        i, i % 16, 12 + i % 8);
+  }
+  page += "</style>\n";
+  page += "<link rel=\"canonical\" href=\"https://example.com/article\">\n";
+  page += "</head>\n<body>\n";
+  for (int i = 0; i < 500; ++i) {
+    page += "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit.</p>\n";
+  }
+  page += "</body>\n</html>\n";
+  return page;
+}
+
+// What the loader used to do: rerun the regexes over the whole buffer every
+// time a chunk comes in.
+void ScanByRescanning(const std::string& page) {
+  std::string buffer;
+  for (size_t offset = 0; offset < page.size(); offset += kChunkSize) {
+    buffer.append(page, offset, kChunkSize);
+    if (!CheckIfAmpPage(buffer)) {
+      return;
+    }
+    if (FindCanonicalAmpUrl(buffer).has_value()) {
+      return;
+    }
+  }
+}
+
+void ScanIncrementally(const std::string& page) {
+  DeAmpBodyScanner scanner;
+  for (size_t size = kChunkSize;; size += kChunkSize) {
+    const auto result = scanner.Scan(base::StringPiece(page).substr(0, size));
+    if (result != DeAmpBodyScanner::Result::kNeedMoreData ||
+        size >= page.size()) {
+      return;
+    }
+  }
+}
+
+template <typename ScanFunction>
+void RunTest(const std::string& story,
+             const std::string& page,
+             ScanFunction scan) {
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    scan(page);
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+
+  perf_test::PerfResultReporter reporter("DeAmpBodyScanner", story);
+  reporter.RegisterImportantMetric(".time_per_page", "us");
+  reporter.AddResult(".time_per_page", timer.TimePerLap().InMicrosecondsF());
+}
+
+}  // namespace
+
+TEST(DeAmpBodyScannerPerfTest, AmpPageInSmallChunks) {
+  const std::string page = BuildAmpPage(true);
+  RunTest("rescan_amp", page, &ScanByRescanning);
+  RunTest("incremental_amp", page, &ScanIncrementally);
+}
+
+TEST(DeAmpBodyScannerPerfTest, NonAmpPageInSmallChunks) {
+  const std::string page = BuildAmpPage(false);
+  RunTest("rescan_non_amp", page, &ScanByRescanning);
+  RunTest("incremental_non_amp", page, &ScanIncrementally);
+}
+
+}  // namespace de_amp
@@ -0,0 +1,167 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/de_amp/browser/de_amp_body_scanner.h"
+
+#include <algorithm>
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace de_amp {
+
+namespace {
+
+// Feeds |body| to a fresh scanner |chunk_size| bytes at a time and returns
+// the first decisive result.
+DeAmpBodyScanner::Result ScanInChunks(DeAmpBodyScanner* scanner,
+                                      const std::string& body,
+                                      size_t chunk_size) {
+  auto result = DeAmpBodyScanner::Result::kNeedMoreData;
+  for (size_t size = chunk_size;; size += chunk_size) {
+    result = scanner->Scan(
+        base::StringPiece(body).substr(0, std::min(size, body.size())));
+    if (result != DeAmpBodyScanner::Result::kNeedMoreData ||
+        size >= body.size()) {
+      break;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(DeAmpBodyScannerUnitTest, FindsCanonicalInOneChunk) {
+  const std::string body =
+      "<html amp>"
+      "<head>"
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head>"
+      "<body></body>"
+      "</html>";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kCanonicalUrlFound, scanner.Scan(body));
+  EXPECT_TRUE(scanner.is_amp());
+  EXPECT_EQ("https://abc.com", scanner.canonical_url());
+}
+
+TEST(DeAmpBodyScannerUnitTest, FindsCanonicalAcrossSmallChunks) {
+  const std::string body =
+      "<!DOCTYPE html>\n"
+      "<html ⚡ lang=\"en\">\n"
+      "<head>\n"
+      "<meta charset=\"utf-8\">\n"
+      "<script async src=\"https://cdn.ampproject.org/v0.js\"></script>\n"
+      "<link rel=\"author\" href=\"https://xyz.com\"/>\n"
+      "<link rel=\"canonical\" href=\"https://abc.com/article\"/>\n"
+      "</head><body></body></html>";
+  for (size_t chunk_size = 1; chunk_size < 8; ++chunk_size) {
+    DeAmpBodyScanner scanner;
+    EXPECT_EQ(DeAmpBodyScanner::Result::kCanonicalUrlFound,
+              ScanInChunks(&scanner, body, chunk_size));
+    EXPECT_EQ("https://abc.com/article", scanner.canonical_url());
+  }
+}
+
+TEST(DeAmpBodyScannerUnitTest, WaitsAcrossPrologChunks) {
+  const std::string body =
+      "\xEF\xBB\xBF<!DOCTYPE html>\n"
+      "<!-- served from cache -->\n";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData, scanner.Scan(body));
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData,
+            scanner.Scan(body + "<html amp><head>"));
+  EXPECT_EQ(DeAmpBodyScanner::Result::kCanonicalUrlFound,
+            scanner.Scan(body +
+                         "<html amp><head>"
+                         "<link rel=\"canonical\" href=\"https://a.com\">"));
+  EXPECT_EQ("https://a.com", scanner.canonical_url());
+}
+
+TEST(DeAmpBodyScannerUnitTest, CommentContainingTagEndBeforeHtmlTag) {
+  const std::string body =
+      "<!DOCTYPE html>"
+      "<!-- a > b <p>not markup</p> -- > -->"
+      "<html amp>"
+      "<head>"
+      "<!-- <link rel=\"canonical\" href=\"https://xyz.com\"> -->"
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head>";
+  for (size_t chunk_size = 1; chunk_size <= body.size(); ++chunk_size) {
+    DeAmpBodyScanner scanner;
+    EXPECT_EQ(DeAmpBodyScanner::Result::kCanonicalUrlFound,
+              ScanInChunks(&scanner, body, chunk_size));
+    EXPECT_TRUE(scanner.is_amp());
+    EXPECT_EQ("https://abc.com", scanner.canonical_url());
+  }
+}
+
+TEST(DeAmpBodyScannerUnitTest, WaitsForCutOffComment) {
+  const std::string body = "<!-- a > b --";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData, scanner.Scan(body));
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData,
+            scanner.Scan(body + "><html amp>"));
+  EXPECT_TRUE(scanner.is_amp());
+}
+
+TEST(DeAmpBodyScannerUnitTest, ElementBeforeHtmlTag) {
+  const std::string body =
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "<html amp>"
+      "<head></head><body></body></html>";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNotAmp, scanner.Scan(body));
+}
+
+TEST(DeAmpBodyScannerUnitTest, ReleasesNonAmpAsSoonAsHtmlTagIsSeen) {
+  const std::string body =
+      "<html lang=\"en\">"
+      "<head>"
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head>";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNotAmp,
+            scanner.Scan(base::StringPiece(body).substr(0, 17)));
+  EXPECT_FALSE(scanner.is_amp());
+}
+
+TEST(DeAmpBodyScannerUnitTest, WaitsForCutOffHtmlTag) {
+  DeAmpBodyScanner scanner;
+  const std::string body = "<!DOCTYPE html><html a";
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData, scanner.Scan(body));
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData,
+            scanner.Scan(body + "mp>"));
+  EXPECT_TRUE(scanner.is_amp());
+}
+
+TEST(DeAmpBodyScannerUnitTest, NoHtmlTag) {
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNotAmp,
+            scanner.Scan("{\"amp\": \"<xyz html amp>\"}"));
+}
+
+TEST(DeAmpBodyScannerUnitTest, AmpWithoutCanonicalHref) {
+  const std::string body =
+      "<html amp>"
+      "<head>"
+      "<link rel=\"canonical\"/>"
+      "</head>";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kCanonicalUrlNotFound,
+            scanner.Scan(body));
+  EXPECT_TRUE(scanner.is_amp());
+}
+
+TEST(DeAmpBodyScannerUnitTest, AmpWithoutCanonicalLinkNeedsMoreData) {
+  const std::string body =
+      "<html amp>"
+      "<head>"
+      "<link rel=\"author\" href=\"https://xyz.com\"/>";
+  DeAmpBodyScanner scanner;
+  EXPECT_EQ(DeAmpBodyScanner::Result::kNeedMoreData, scanner.Scan(body));
+}
+
+}  // namespace de_amp
@@ -0,0 +1,117 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+scoped_refptr<base::RefCountedMemory> ReadImageFile(
+    const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return nullptr;
+  return base::MakeRefCounted<base::RefCountedString>(std::move(contents));
+}
+
+}  // namespace
+
+NTPImageCache::NTPImageCache(size_t max_size_bytes)
+    : max_size_bytes_(max_size_bytes),
+      images_(decltype(images_)::NO_AUTO_EVICT) {}
+
+NTPImageCache::~NTPImageCache() = default;
+
+void NTPImageCache::GetImage(const base::FilePath& image_file,
+                             GetImageCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  auto it = images_.Get(image_file);
+  if (it != images_.end()) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(callback), it->second));
+    return;
+  }
+
+  auto [pending, inserted] = pending_reads_.try_emplace(image_file);
+  pending->second.push_back(std::move(callback));
+  // Otherwise another request for the same file already started reading it.
+  if (inserted)
+    ReadImage(image_file);
+}
+
+void NTPImageCache::Prefetch(const base::FilePath& image_file) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (image_file.empty() || images_.Peek(image_file) != images_.end())
+    return;
+
+  // An empty list marks the read as in flight without anyone waiting on it.
+  if (pending_reads_.try_emplace(image_file).second)
+    ReadImage(image_file);
+}
+
+void NTPImageCache::Clear() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  images_.Clear();
+  size_bytes_ = 0;
+  generation_++;
+}
+
+void NTPImageCache::ReadImage(const base::FilePath& image_file) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock()}, base::BindOnce(&ReadImageFile, image_file),
+      base::BindOnce(&NTPImageCache::OnImageRead, weak_factory_.GetWeakPtr(),
+                     image_file, generation_));
+}
+
+void NTPImageCache::OnImageRead(const base::FilePath& image_file,
+                                int generation,
+                                scoped_refptr<base::RefCountedMemory> image) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (image && generation == generation_)
+    Put(image_file, image);
+
+  auto node = pending_reads_.extract(image_file);
+  if (node.empty())
+    return;
+  for (auto& callback : node.mapped())
+    std::move(callback).Run(image);
+}
+
+void NTPImageCache::Put(const base::FilePath& image_file,
+                        scoped_refptr<base::RefCountedMemory> image) {
+  // Not worth evicting everything else for.
+  if (image->size() > max_size_bytes_)
+    return;
+
+  auto it = images_.Peek(image_file);
+  if (it != images_.end()) {
+    size_bytes_ -= it->second->size();
+    images_.Erase(it);
+  }
+
+  while (!images_.empty() && size_bytes_ + image->size() > max_size_bytes_) {
+    auto oldest = images_.rbegin();
+    size_bytes_ -= oldest->second->size();
+    images_.Erase(oldest);
+  }
+
+  size_bytes_ += image->size();
+  images_.Put(image_file, std::move(image));
+}
+
+}  // namespace ntp_background_images
@@ -0,0 +1,75 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+
+#include <map>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+
+namespace ntp_background_images {
+
+// Keeps recently served NTP background and sponsored image bytes in memory so
+// that opening a new tab doesn't have to read the image from disk again.
+// Images are evicted least recently used first once the cache grows beyond
+// |max_size_bytes|. Reads of the same file that are in flight at the same time
+// are done only once.
+class NTPImageCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  static constexpr size_t kDefaultMaxSizeBytes = 20 * 1024 * 1024;
+
+  explicit NTPImageCache(size_t max_size_bytes = kDefaultMaxSizeBytes);
+  ~NTPImageCache();
+
+  NTPImageCache(const NTPImageCache&) = delete;
+  NTPImageCache& operator=(const NTPImageCache&) = delete;
+
+  // Runs |callback| asynchronously with the contents of |image_file|, or with
+  // nullptr if it can't be read.
+  void GetImage(const base::FilePath& image_file, GetImageCallback callback);
+
+  // Reads |image_file| into the cache if it isn't there yet.
+  void Prefetch(const base::FilePath& image_file);
+
+  // Drops all cached images, e.g. when the component providing them updated.
+  // Reads in flight still answer their callbacks but aren't cached.
+  void Clear();
+
+  size_t size_bytes() const { return size_bytes_; }
+
+ private:
+  void ReadImage(const base::FilePath& image_file);
+  void OnImageRead(const base::FilePath& image_file,
+                   int generation,
+                   scoped_refptr<base::RefCountedMemory> image);
+  void Put(const base::FilePath& image_file,
+           scoped_refptr<base::RefCountedMemory> image);
+
+  const size_t max_size_bytes_;
+  size_t size_bytes_ = 0;
+  // Bumped by Clear() so that reads started before it aren't cached.
+  int generation_ = 0;
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      images_;
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<NTPImageCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
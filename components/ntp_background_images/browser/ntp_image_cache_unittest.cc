@@ -0,0 +1,104 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageCacheTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath WriteImage(const std::string& name,
+                            const std::string& contents) {
+    const base::FilePath path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    return path;
+  }
+
+  std::string GetImage(NTPImageCache* cache, const base::FilePath& path) {
+    base::test::TestFuture<scoped_refptr<base::RefCountedMemory>> future;
+    cache->GetImage(path, future.GetCallback());
+    auto image = future.Take();
+    if (!image)
+      return "<null>";
+    return std::string(image->front_as<char>(), image->size());
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(NTPImageCacheTest, ServesFromMemory) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("background-1.jpg", "image-1");
+  EXPECT_EQ(GetImage(&cache, path), "image-1");
+  EXPECT_EQ(cache.size_bytes(), 7u);
+
+  // The file is gone, but the cached bytes are still served.
+  ASSERT_TRUE(base::DeleteFile(path));
+  EXPECT_EQ(GetImage(&cache, path), "image-1");
+
+  cache.Clear();
+  EXPECT_EQ(cache.size_bytes(), 0u);
+  EXPECT_EQ(GetImage(&cache, path), "<null>");
+}
+
+TEST_F(NTPImageCacheTest, Prefetch) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("background-2.jpg", "image-2");
+  cache.Prefetch(path);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(cache.size_bytes(), 7u);
+
+  ASSERT_TRUE(base::DeleteFile(path));
+  EXPECT_EQ(GetImage(&cache, path), "image-2");
+}
+
+TEST_F(NTPImageCacheTest, ClearDropsReadsInFlight) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("background-3.jpg", "image-3");
+  base::test::TestFuture<scoped_refptr<base::RefCountedMemory>> future;
+  cache.GetImage(path, future.GetCallback());
+  cache.Clear();
+
+  // The pending request is still answered, but the image isn't kept.
+  ASSERT_TRUE(future.Get());
+  EXPECT_EQ(cache.size_bytes(), 0u);
+}
+
+TEST_F(NTPImageCacheTest, EvictsLeastRecentlyUsed) {
+  NTPImageCache cache(10);
+  const base::FilePath path_a = WriteImage("a.jpg", "aaaa");
+  const base::FilePath path_b = WriteImage("b.jpg", "bbbb");
+  const base::FilePath path_c = WriteImage("c.jpg", "cccc");
+  const base::FilePath large = WriteImage("large.jpg", "larger than ten");
+
+  EXPECT_EQ(GetImage(&cache, path_a), "aaaa");
+  EXPECT_EQ(GetImage(&cache, path_b), "bbbb");
+  // Touch |path_a| so that |path_b| is the least recently used.
+  EXPECT_EQ(GetImage(&cache, path_a), "aaaa");
+  EXPECT_EQ(GetImage(&cache, path_c), "cccc");
+  EXPECT_EQ(cache.size_bytes(), 8u);
+
+  ASSERT_TRUE(base::DeleteFile(path_a));
+  ASSERT_TRUE(base::DeleteFile(path_b));
+  EXPECT_EQ(GetImage(&cache, path_a), "aaaa");
+  EXPECT_EQ(GetImage(&cache, path_b), "<null>");
+
+  // Images larger than the whole cache are served but not kept.
+  EXPECT_EQ(GetImage(&cache, large), "larger than ten");
+  EXPECT_EQ(cache.size_bytes(), 8u);
+}
+
+}  // namespace ntp_background_images
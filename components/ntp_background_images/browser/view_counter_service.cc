@@ -153,6 +153,7 @@ ViewCounterService::GetCurrentWallpaperForDisplay() {
     absl::optional<base::Value::Dict> branded_wallpaper =
         GetCurrentBrandedWallpaper();
     if (branded_wallpaper) {
+      PrefetchNextWallpaperImage();
       return branded_wallpaper;
     }
     // Failed to get branded wallpaper as it was frequency capped by ads
@@ -162,7 +163,44 @@ ViewCounterService::GetCurrentWallpaperForDisplay() {
     model_.IncreaseBackgroundWallpaperImageIndex();
   }
 
-  return GetCurrentWallpaper();
+  absl::optional<base::Value::Dict> wallpaper = GetCurrentWallpaper();
+  PrefetchNextWallpaperImage();
+  return wallpaper;
+}
+
+void ViewCounterService::PrefetchNextWallpaperImage() {
+  // Sponsored images are picked randomly per campaign, so only the super
+  // referral images and the background images have a predictable successor.
+  NTPSponsoredImagesData* branded_data = GetCurrentBrandedWallpaperData();
+  if (branded_data && branded_data->IsSuperReferral() &&
+      IsBrandedWallpaperActive()) {
+    size_t campaign_index;
+    size_t background_index;
+    std::tie(campaign_index, background_index) =
+        model_.GetCurrentBrandedImageIndex();
+    if (campaign_index >= branded_data->campaigns.size())
+      return;
+    const auto& backgrounds =
+        branded_data->campaigns[campaign_index].backgrounds;
+    if (backgrounds.empty())
+      return;
+    service_->image_cache()->Prefetch(
+        backgrounds[(background_index + 1) % backgrounds.size()].image_file);
+    return;
+  }
+
+  auto* data = GetCurrentWallpaperData();
+  if (!data || data->backgrounds.empty() || !IsBackgroundWallpaperActive())
+    return;
+
+#if BUILDFLAG(ENABLE_CUSTOM_BACKGROUND)
+  if (ShouldShowCustomBackground())
+    return;
+#endif
+
+  const size_t next_index =
+      (model_.current_wallpaper_image_index() + 1) % data->backgrounds.size();
+  service_->image_cache()->Prefetch(data->backgrounds[next_index].image_file);
 }
 
 absl::optional<base::Value::Dict> ViewCounterService::GetCurrentWallpaper()
@@ -157,6 +157,9 @@ class ViewCounterService : public KeyedService,
 
   void MaybePrefetchNewTabPageAd();
 
+  // Warms the image cache with the wallpaper the next new tab will show.
+  void PrefetchNextWallpaperImage();
+
   void UpdateP3AValues() const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;
@@ -78,25 +78,43 @@ void BraveP3ALogStore::RegisterPrefs(PrefRegistrySimple* registry) {
 
 void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
                                    uint64_t value) {
-  LogEntry& entry = log_[histogram_name];
+  auto [iter, inserted] = log_.try_emplace(histogram_name);
+  LogEntry& entry = iter->second;
+  if (!inserted && entry.value == value) {
+    return;
+  }
   entry.value = value;
 
   if (!entry.sent) {
     DCHECK(entry.sent_timestamp.is_null());
     unsent_entries_.insert(histogram_name);
   }
+  uncommitted_entries_.insert(histogram_name);
+}
 
-  // Update the persistent value.
+void BraveP3ALogStore::CommitPendingValues() {
+  if (uncommitted_entries_.empty()) {
+    return;
+  }
+
+  // Update the persistent values.
   DictionaryPrefUpdate update(local_state_, GetPrefName(type_));
-  update->SetPath({histogram_name, kLogValueKey},
-                  base::Value(base::NumberToString(value)));
-  update->SetPath({histogram_name, kLogSentKey}, base::Value(entry.sent));
+  for (const std::string& histogram_name : uncommitted_entries_) {
+    auto iter = log_.find(histogram_name);
+    DCHECK(iter != log_.end());
+    update->SetPath({histogram_name, kLogValueKey},
+                    base::Value(base::NumberToString(iter->second.value)));
+    update->SetPath({histogram_name, kLogSentKey},
+                    base::Value(iter->second.sent));
+  }
+  uncommitted_entries_.clear();
 }
 
 void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
   DCHECK(delegate_->IsActualMetric(histogram_name));
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
+  uncommitted_entries_.erase(histogram_name);
 
   // Update the persistent value.
   DictionaryPrefUpdate(local_state_, GetPrefName(type_))
@@ -21,7 +21,8 @@ class PrefRegistrySimple;
 
 namespace brave {
 
-// Stores all given values in memory and persists in prefs on the fly.
+// Stores all given values in memory. Value updates are persisted in prefs in
+// batches via |CommitPendingValues()|, other changes on the fly.
 // All logs (not only unsent are persistent), and all logs could be loaded
 // using |LoadPersistedUnsentLogs()|. We should fix this at some point since
 // for now persisted entries never expire.
@@ -46,7 +47,11 @@ class BraveP3ALogStore : public metrics::LogStore {
 
   static void RegisterPrefs(PrefRegistrySimple* registry);
 
+  // Updates the in-memory value, which is persisted by the next
+  // |CommitPendingValues()| call.
   void UpdateValue(const std::string& histogram_name, uint64_t value);
+  // Writes all values updated since the last commit with a single pref update.
+  void CommitPendingValues();
   // Removes and also unstages the metric value if it is known and/or staged.
   void RemoveValueIfExists(const std::string& histogram_name);
   // Marks all saved values as unsent.
@@ -97,6 +102,8 @@ class BraveP3ALogStore : public metrics::LogStore {
   // TODO(iefremov): Try to replace with base::StringPiece?
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
+  // Entries whose value has not been persisted yet.
+  base::flat_set<std::string> uncommitted_entries_;
 
   std::string staged_entry_key_;
   std::string staged_log_;
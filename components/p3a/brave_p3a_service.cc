@@ -13,6 +13,7 @@
 #include "base/command_line.h"
 #include "base/i18n/timezone.h"
 #include "base/json/json_writer.h"
+#include "base/metrics/bucket_ranges.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/metrics/histogram_samples.h"
 #include "base/metrics/sample_vector.h"
@@ -77,11 +78,27 @@ constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
 constexpr base::TimeDelta kPostRotationUploadDelay = base::Seconds(30);
 
+// How long histogram changes are collected before being handed over to the
+// log stores. Must stay well below |kPostRotationUploadDelay|, so that values
+// recorded by rotation callbacks are stored before uploads resume.
+constexpr base::TimeDelta kHistogramChangesFlushDelay = base::Seconds(5);
+
 bool IsSuspendedMetric(base::StringPiece metric_name,
                        uint64_t value_or_bucket) {
   return value_or_bucket == kSuspendedMetricBucket;
 }
 
+// Returns the bucket of |ranges| which |sample| falls into.
+size_t GetBucketIndex(const base::BucketRanges& ranges,
+                      base::HistogramBase::Sample sample) {
+  size_t bucket = 0u;
+  while (bucket + 1 < ranges.bucket_count() &&
+         ranges.range(bucket + 1) <= sample) {
+    bucket++;
+  }
+  return bucket;
+}
+
 base::TimeDelta GetRandomizedUploadInterval(
     base::TimeDelta average_upload_interval) {
   const auto delta = base::Seconds(
@@ -318,6 +335,9 @@ void BraveP3AService::Init(
     HandleHistogramChange(std::string(entry.first), entry.second);
   }
   histogram_values_ = {};
+  for (auto& [log_type, log_store] : log_stores_) {
+    log_store->CommitPendingValues();
+  }
 }
 
 std::string BraveP3AService::Serialize(base::StringPiece histogram_name,
@@ -470,45 +490,68 @@ void BraveP3AService::StartScheduledUpload(MetricLogType log_type) {
   }
 }
 
+void BraveP3AService::Shutdown() {
+  FlushPendingHistogramChanges();
+}
+
 void BraveP3AService::OnHistogramChanged(const char* histogram_name,
                                          uint64_t name_hash,
                                          base::HistogramBase::Sample sample) {
   DCHECK(histogram_name != nullptr);
+  {
+    base::AutoLock lock(pending_histogram_changes_lock_);
+    // Only the latest sample of a histogram matters.
+    pending_histogram_changes_[histogram_name] = sample;
+    if (is_flush_scheduled_) {
+      return;
+    }
+    is_flush_scheduled_ = true;
+  }
+  GetUIThreadTaskRunner()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&BraveP3AService::FlushPendingHistogramChanges, this),
+      kHistogramChangesFlushDelay);
+}
 
-  std::unique_ptr<base::HistogramSamples> samples =
-      base::StatisticsRecorder::FindHistogram(histogram_name)->SnapshotDelta();
+absl::optional<size_t> BraveP3AService::SnapshotHistogramBucket(
+    base::StringPiece histogram_name,
+    base::HistogramBase::Sample latest_sample) {
+  base::HistogramBase* histogram =
+      base::StatisticsRecorder::FindHistogram(histogram_name);
+  if (!histogram) {
+    return absl::nullopt;
+  }
+  // Taken once per batch, so that the delta holds all samples recorded since
+  // the previous one.
+  std::unique_ptr<base::HistogramSamples> samples = histogram->SnapshotDelta();
 
   // Stop now if there's nothing to do.
   if (samples->Iterator()->Done())
-    return;
+    return absl::nullopt;
 
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
-  if (IsSuspendedMetric(histogram_name, sample)) {
-    GetUIThreadTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this, histogram_name, kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
-    return;
+  if (IsSuspendedMetric(histogram_name, latest_sample)) {
+    return kSuspendedMetricBucket;
   }
 
   // Note that we store only buckets, not actual values.
-  size_t bucket = 0u;
-  const bool ok = samples->Iterator()->GetBucketIndex(&bucket);
-  if (!ok) {
+  size_t first_bucket = 0u;
+  if (!samples->Iterator()->GetBucketIndex(&first_bucket)) {
     LOG(ERROR) << "Only linear histograms are supported at the moment!";
     NOTREACHED();
-    return;
+    return absl::nullopt;
   }
+  base::SampleVector* vector = static_cast<base::SampleVector*>(samples.get());
+  DCHECK(vector);
+  // The delta may hold several samples, the bucket of the latest one is kept.
+  size_t bucket = GetBucketIndex(*vector->bucket_ranges(), latest_sample);
 
   // Special handling of P2A histograms.
   if (base::StartsWith(histogram_name, "Brave.P2A.",
                        base::CompareCase::SENSITIVE)) {
     // We need the bucket count to make proper perturbation.
     // All P2A metrics should be implemented as linear histograms.
-    base::SampleVector* vector =
-        static_cast<base::SampleVector*>(samples.get());
-    DCHECK(vector);
     const size_t bucket_count = vector->bucket_ranges()->bucket_count() - 1;
     VLOG(2) << "P2A metric " << histogram_name << " has bucket count "
             << bucket_count;
@@ -517,21 +560,41 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  GetUIThreadTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  VLOG(2) << "BraveP3AService::SnapshotHistogramBucket: histogram_name = "
+          << histogram_name << " Sample = " << latest_sample
+          << " bucket = " << bucket;
+  return bucket;
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
-                                             base::HistogramBase::Sample sample,
-                                             size_t bucket) {
-  VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
-  if (!initialized_) {
-    // Will handle it later when ready.
-    histogram_values_[histogram_name] = bucket;
-  } else {
-    HandleHistogramChange(histogram_name, bucket);
+void BraveP3AService::FlushPendingHistogramChanges() {
+  DCheckCurrentlyOnUIThread();
+  base::flat_map<base::StringPiece, base::HistogramBase::Sample> changes;
+  {
+    base::AutoLock lock(pending_histogram_changes_lock_);
+    changes.swap(pending_histogram_changes_);
+    is_flush_scheduled_ = false;
+  }
+  VLOG(2) << "BraveP3AService::FlushPendingHistogramChanges: "
+          << changes.size() << " histograms changed";
+
+  for (const auto& [histogram_name, sample] : changes) {
+    absl::optional<size_t> bucket =
+        SnapshotHistogramBucket(histogram_name, sample);
+    if (!bucket) {
+      continue;
+    }
+    if (!initialized_) {
+      // Will handle it later when ready.
+      histogram_values_[histogram_name] = *bucket;
+      continue;
+    }
+    // Dynamic metrics may have been removed while the change was pending.
+    if (IsActualMetric(histogram_name)) {
+      HandleHistogramChange(histogram_name, *bucket);
+    }
+  }
+  for (auto& [log_type, log_store] : log_stores_) {
+    log_store->CommitPendingValues();
   }
 }
 
@@ -16,10 +16,13 @@
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "base/timer/wall_clock_timer.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/p3a_message.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 class PrefRegistrySimple;
@@ -84,8 +87,14 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // May be accessed from multiple threads, so this is thread-safe.
   bool IsActualMetric(base::StringPiece histogram_name) const override;
 
+  // Stores the histogram changes still waiting for the next batch. Must be
+  // called on browser shutdown, while local state is still alive.
+  void Shutdown();
+
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
+  // can fire on any thread, this method only records the latest sample of the
+  // histogram, and the pending changes are handed over to the UI thread in
+  // batches.
   void OnHistogramChanged(const char* histogram_name,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
@@ -105,9 +114,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
 
   void StartScheduledUpload(MetricLogType log_type);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  // Hands all pending histogram changes over to the log stores, which then
+  // persist them with a single pref update each.
+  void FlushPendingHistogramChanges();
+
+  // Takes the delta of the histogram since the previous batch and returns the
+  // bucket to store for it, if any.
+  absl::optional<size_t> SnapshotHistogramBucket(
+      base::StringPiece histogram_name,
+      base::HistogramBase::Sample latest_sample);
 
   // Updates or removes a metric from the log.
   void HandleHistogramChange(base::StringPiece histogram_name, size_t bucket);
@@ -162,6 +177,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Latest sample of each histogram that changed since the last flush.
+  // Chatty histograms are coalesced here rather than each sample hopping to
+  // the UI thread and writing to local state.
+  base::Lock pending_histogram_changes_lock_;
+  base::flat_map<base::StringPiece, base::HistogramBase::Sample>
+      pending_histogram_changes_
+      GUARDED_BY(pending_histogram_changes_lock_);
+  bool is_flush_scheduled_ GUARDED_BY(pending_histogram_changes_lock_) = false;
+
   std::vector<
       std::unique_ptr<base::StatisticsRecorder::ScopedHistogramSampleObserver>>
       histogram_sample_callbacks_;
@@ -267,6 +267,40 @@ TEST_F(P3AServiceTest, MetricSentCallback) {
   }
 }
 
+TEST_F(P3AServiceTest, CoalescesHistogramChanges) {
+  const std::string histogram_name = GetTestHistogramNames(1, 0)[0];
+
+  for (int i = 1; i <= 5; i++) {
+    base::UmaHistogramExactLinear(histogram_name, i, 8);
+    p3a_service_->OnHistogramChanged(histogram_name.c_str(), 0, i);
+  }
+  task_environment_.RunUntilIdle();
+  // Nothing is persisted until the batch is flushed.
+  EXPECT_FALSE(local_state_.GetDict("p3a.logs").Find(histogram_name));
+
+  task_environment_.FastForwardBy(base::Seconds(5));
+  const base::Value::Dict* entry =
+      local_state_.GetDict("p3a.logs").FindDict(histogram_name);
+  ASSERT_TRUE(entry);
+  // Only the latest bucket is stored.
+  EXPECT_EQ(*entry->FindString("value"), "5");
+}
+
+TEST_F(P3AServiceTest, StoresPendingHistogramChangesOnShutdown) {
+  const std::string histogram_name = GetTestHistogramNames(1, 0)[0];
+
+  base::UmaHistogramExactLinear(histogram_name, 3, 8);
+  p3a_service_->OnHistogramChanged(histogram_name.c_str(), 0, 3);
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(local_state_.GetDict("p3a.logs").Find(histogram_name));
+
+  p3a_service_->Shutdown();
+  const base::Value::Dict* entry =
+      local_state_.GetDict("p3a.logs").FindDict(histogram_name);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(*entry->FindString("value"), "3");
+}
+
 TEST_F(P3AServiceTest, ShouldNotSendIfDisabled) {
   std::vector<std::string> test_histograms = GetTestHistogramNames(3, 3);
 
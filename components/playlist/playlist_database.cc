@@ -0,0 +1,306 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/playlist/playlist_database.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/check.h"
+#include "base/files/file_util.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "base/numerics/safe_conversions.h"
+#include "brave/components/playlist/playlist_constants.h"
+#include "sql/recovery.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace playlist {
+
+namespace {
+
+void DatabaseErrorCallback(sql::Database* db,
+                           const base::FilePath& db_file_path,
+                           int extended_error,
+                           sql::Statement* stmt) {
+  if (sql::Recovery::ShouldRecover(extended_error)) {
+    // Prevent reentrant calls.
+    db->reset_error_callback();
+
+    // After this call, the |db| handle is poisoned so that future calls will
+    // return errors until the handle is re-opened.
+    sql::Recovery::RecoverDatabase(db, db_file_path);
+
+    // The ignored call signals the test-expectation framework that the error
+    // was handled.
+    std::ignore = sql::Database::IsExpectedSqliteError(extended_error);
+    return;
+  }
+
+  // The default handling is to assert on debug and to ignore on release.
+  if (!sql::Database::IsExpectedSqliteError(extended_error))
+    DLOG(FATAL) << db->GetErrorMessage();
+}
+
+}  // namespace
+
+PlaylistDatabase::Contents::Contents() = default;
+PlaylistDatabase::Contents::Contents(Contents&&) = default;
+PlaylistDatabase::Contents& PlaylistDatabase::Contents::operator=(Contents&&) =
+    default;
+PlaylistDatabase::Contents::~Contents() = default;
+
+PlaylistDatabase::PlaylistDatabase(const base::FilePath& db_file_path)
+    : database_(
+          {.exclusive_locking = true, .page_size = 4096, .cache_size = 500}),
+      db_file_path_(db_file_path) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+PlaylistDatabase::~PlaylistDatabase() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+bool PlaylistDatabase::Init(base::Value::Dict legacy_playlists,
+                            base::Value::Dict legacy_items) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("Playlist");
+
+  // To recover from corruption.
+  database_.set_error_callback(
+      base::BindRepeating(&DatabaseErrorCallback, &database_, db_file_path_));
+
+  if (!base::CreateDirectory(db_file_path_.DirName()) ||
+      !database_.Open(db_file_path_)) {
+    return false;
+  }
+
+  // The tables only exist once the prefs have been imported. Prefs found after
+  // that hold the changes of a session that couldn't open the database, and
+  // are merged into it.
+  if (database_.DoesTableExist("playlists")) {
+    if (legacy_playlists.empty() && legacy_items.empty())
+      return true;
+
+    sql::Transaction transaction(&database_);
+    return transaction.Begin() && Import(legacy_playlists, legacy_items) &&
+           transaction.Commit();
+  }
+
+  // Creating the tables and importing the prefs either both happen or neither
+  // does, so that a failed import is retried on the next run.
+  sql::Transaction transaction(&database_);
+  return transaction.Begin() && CreateTables() &&
+         Import(legacy_playlists, legacy_items) && transaction.Commit();
+}
+
+PlaylistDatabase::Contents PlaylistDatabase::Load() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  Contents contents;
+  sql::Statement playlists(
+      database_.GetUniqueStatement("SELECT id, name FROM playlists"));
+  while (playlists.Step()) {
+    base::Value::Dict playlist;
+    playlist.Set(kPlaylistIDKey, playlists.ColumnString(0));
+    playlist.Set(kPlaylistNameKey, playlists.ColumnString(1));
+    playlist.Set(kPlaylistItemsKey, base::Value::List());
+    contents.playlists.Set(playlists.ColumnString(0), std::move(playlist));
+  }
+
+  sql::Statement playlist_items(database_.GetUniqueStatement(
+      "SELECT playlist_id, item_id FROM playlist_items "
+      "ORDER BY playlist_id, position"));
+  while (playlist_items.Step()) {
+    auto* playlist =
+        contents.playlists.FindDict(playlist_items.ColumnString(0));
+    if (playlist) {
+      playlist->FindList(kPlaylistItemsKey)
+          ->Append(playlist_items.ColumnString(1));
+    }
+  }
+
+  sql::Statement items(
+      database_.GetUniqueStatement("SELECT id, value FROM items"));
+  while (items.Step()) {
+    auto value = base::JSONReader::Read(items.ColumnString(1));
+    if (!value || !value->is_dict()) {
+      LOG(ERROR) << __func__ << " Malformed item " << items.ColumnString(0);
+      continue;
+    }
+    contents.items.Set(items.ColumnString(0), std::move(value->GetDict()));
+  }
+
+  return contents;
+}
+
+std::vector<base::Value::Dict> PlaylistDatabase::GetPlaylistItems(
+    const std::string& playlist_id,
+    size_t offset,
+    size_t count) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT items.value FROM playlist_items "
+      "JOIN items ON items.id = playlist_items.item_id "
+      "WHERE playlist_items.playlist_id = ? "
+      "ORDER BY playlist_items.position LIMIT ? OFFSET ?"));
+  statement.BindString(0, playlist_id);
+  statement.BindInt64(1, base::saturated_cast<int64_t>(count));
+  statement.BindInt64(2, base::saturated_cast<int64_t>(offset));
+
+  std::vector<base::Value::Dict> items;
+  while (statement.Step()) {
+    auto value = base::JSONReader::Read(statement.ColumnString(0));
+    if (value && value->is_dict())
+      items.push_back(std::move(value->GetDict()));
+  }
+  return items;
+}
+
+bool PlaylistDatabase::SetPlaylist(base::Value::Dict playlist) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  return transaction.Begin() && InsertPlaylist(playlist) &&
+         transaction.Commit();
+}
+
+bool PlaylistDatabase::DeletePlaylist(const std::string& id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin())
+    return false;
+
+  sql::Statement delete_items(database_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM playlist_items WHERE playlist_id = ?"));
+  delete_items.BindString(0, id);
+  sql::Statement delete_playlist(database_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM playlists WHERE id = ?"));
+  delete_playlist.BindString(0, id);
+  return delete_items.Run() && delete_playlist.Run() && transaction.Commit();
+}
+
+bool PlaylistDatabase::SetItem(const std::string& id, base::Value::Dict item) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return InsertItem(id, item);
+}
+
+bool PlaylistDatabase::DeleteItem(const std::string& id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM items WHERE id = ?"));
+  statement.BindString(0, id);
+  return statement.Run();
+}
+
+bool PlaylistDatabase::DeleteAllItems() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return database_.Execute("DELETE FROM items");
+}
+
+bool PlaylistDatabase::DeleteAll() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  return transaction.Begin() && database_.Execute("DELETE FROM items") &&
+         database_.Execute("DELETE FROM playlist_items") &&
+         database_.Execute("DELETE FROM playlists") && transaction.Commit();
+}
+
+bool PlaylistDatabase::CreateTables() {
+  return database_.Execute(
+             "CREATE TABLE playlists (id TEXT PRIMARY KEY NOT NULL, "
+             "name TEXT NOT NULL)") &&
+         database_.Execute(
+             "CREATE TABLE items (id TEXT PRIMARY KEY NOT NULL, "
+             "value TEXT NOT NULL)") &&
+         database_.Execute(
+             "CREATE TABLE playlist_items (playlist_id TEXT NOT NULL, "
+             "item_id TEXT NOT NULL, position INTEGER NOT NULL, "
+             "PRIMARY KEY (playlist_id, item_id))") &&
+         database_.Execute(
+             "CREATE INDEX playlist_items_position "
+             "ON playlist_items (playlist_id, position)") &&
+         database_.Execute(
+             "CREATE INDEX playlist_items_item_id "
+             "ON playlist_items (item_id)");
+}
+
+bool PlaylistDatabase::Import(const base::Value::Dict& playlists,
+                              const base::Value::Dict& items) {
+  for (const auto [id, playlist] : playlists) {
+    if (!playlist.is_dict() || !InsertPlaylist(playlist.GetDict()))
+      return false;
+  }
+
+  for (const auto [id, item] : items) {
+    if (!item.is_dict() || !InsertItem(id, item.GetDict()))
+      return false;
+  }
+
+  return true;
+}
+
+bool PlaylistDatabase::InsertPlaylist(const base::Value::Dict& playlist) {
+  const std::string* id = playlist.FindString(kPlaylistIDKey);
+  const std::string* name = playlist.FindString(kPlaylistNameKey);
+  const base::Value::List* item_ids = playlist.FindList(kPlaylistItemsKey);
+  if (!id || !name || !item_ids)
+    return false;
+
+  sql::Statement insert_playlist(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO playlists (id, name) VALUES (?, ?)"));
+  insert_playlist.BindString(0, *id);
+  insert_playlist.BindString(1, *name);
+  if (!insert_playlist.Run())
+    return false;
+
+  // Only this playlist's order is rewritten.
+  sql::Statement delete_items(database_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM playlist_items WHERE playlist_id = ?"));
+  delete_items.BindString(0, *id);
+  if (!delete_items.Run())
+    return false;
+
+  for (size_t i = 0; i < item_ids->size(); i++) {
+    const std::string* item_id = (*item_ids)[i].GetIfString();
+    if (!item_id)
+      return false;
+
+    sql::Statement insert_item(database_.GetCachedStatement(
+        SQL_FROM_HERE,
+        "INSERT OR REPLACE INTO playlist_items (playlist_id, item_id, "
+        "position) VALUES (?, ?, ?)"));
+    insert_item.BindString(0, *id);
+    insert_item.BindString(1, *item_id);
+    insert_item.BindInt64(2, base::checked_cast<int64_t>(i));
+    if (!insert_item.Run())
+      return false;
+  }
+
+  return true;
+}
+
+bool PlaylistDatabase::InsertItem(const std::string& id,
+                                  const base::Value::Dict& item) {
+  std::string value;
+  if (!base::JSONWriter::Write(item, &value))
+    return false;
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE, "INSERT OR REPLACE INTO items (id, value) VALUES (?, ?)"));
+  statement.BindString(0, id);
+  statement.BindString(1, value);
+  return statement.Run();
+}
+
+}  // namespace playlist
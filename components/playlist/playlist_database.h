@@ -0,0 +1,87 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_PLAYLIST_PLAYLIST_DATABASE_H_
+#define BRAVE_COMPONENTS_PLAYLIST_PLAYLIST_DATABASE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/values.h"
+#include "sql/database.h"
+
+namespace playlist {
+
+// Stores playlists and playlist items in SQLite, so that changing a single
+// playlist or item doesn't rewrite every playlist as the prefs did. Playlist
+// membership and order are kept in their own table indexed by playlist and by
+// item, which lets the UI page through a playlist without loading all of it.
+//
+// Values going in and out use the layout of the former kPlaylistsPref and
+// kPlaylistItemsPref prefs. Lives on a blocking sequence, see
+// PlaylistService.
+class PlaylistDatabase {
+ public:
+  // Everything in the database, in the layout of the former prefs.
+  struct Contents {
+    Contents();
+    Contents(Contents&&);
+    Contents& operator=(Contents&&);
+    ~Contents();
+
+    base::Value::Dict playlists;
+    base::Value::Dict items;
+  };
+
+  explicit PlaylistDatabase(const base::FilePath& db_file_path);
+  ~PlaylistDatabase();
+
+  PlaylistDatabase(const PlaylistDatabase&) = delete;
+  PlaylistDatabase& operator=(const PlaylistDatabase&) = delete;
+
+  // Opens the database. |legacy_playlists| and |legacy_items| from prefs are
+  // imported into it when it's created for the first time, and merged into it
+  // when a previous session had to fall back to prefs.
+  bool Init(base::Value::Dict legacy_playlists, base::Value::Dict legacy_items);
+
+  Contents Load();
+
+  // Returns up to |count| item values of |playlist_id| in playlist order,
+  // starting at |offset|.
+  std::vector<base::Value::Dict> GetPlaylistItems(
+      const std::string& playlist_id,
+      size_t offset,
+      size_t count);
+
+  // Adds or replaces |playlist| together with its item order.
+  bool SetPlaylist(base::Value::Dict playlist);
+  bool DeletePlaylist(const std::string& id);
+
+  bool SetItem(const std::string& id, base::Value::Dict item);
+  bool DeleteItem(const std::string& id);
+  bool DeleteAllItems();
+
+  // Deletes all playlists and items.
+  bool DeleteAll();
+
+ private:
+  // These expect to be run in a transaction.
+  bool CreateTables();
+  bool Import(const base::Value::Dict& playlists,
+              const base::Value::Dict& items);
+  bool InsertPlaylist(const base::Value::Dict& playlist);
+  bool InsertItem(const std::string& id, const base::Value::Dict& item);
+
+  sql::Database database_;
+  const base::FilePath db_file_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace playlist
+
+#endif  // BRAVE_COMPONENTS_PLAYLIST_PLAYLIST_DATABASE_H_
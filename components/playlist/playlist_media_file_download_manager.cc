@@ -5,13 +5,17 @@
 
 #include "brave/components/playlist/playlist_media_file_download_manager.h"
 
+#include <iterator>
+#include <limits>
 #include <utility>
 
+#include "base/containers/cxx20_erase_vector.h"
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/threading/sequenced_task_runner_handle.h"
 #include "base/values.h"
 #include "brave/components/playlist/playlist_constants.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace playlist {
 
@@ -21,85 +25,114 @@ PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
     const base::FilePath& base_dir)
     : base_dir_(base_dir), delegate_(delegate) {
   // TODO(pilgrim) dynamically set file extensions based on format.
-  media_file_downloader_ = std::make_unique<PlaylistMediaFileDownloader>(
-      this, context, kMediaFileName);
+  for (size_t i = 0; i < kMaxConcurrentDownloads; i++) {
+    media_file_downloaders_.push_back(
+        std::make_unique<PlaylistMediaFileDownloader>(this, context,
+                                                      kMediaFileName));
+  }
 }
 
 PlaylistMediaFileDownloadManager::~PlaylistMediaFileDownloadManager() = default;
 
 void PlaylistMediaFileDownloadManager::DownloadMediaFile(
     const PlaylistItemInfo& playlist_item) {
-  pending_media_file_creation_jobs_.push(playlist_item);
+  pending_media_file_creation_jobs_.push_back(playlist_item);
 
-  // If either media file controller is generating a playlist media file,
-  // delay the next playlist generation. It will be triggered when the current
-  // one is finished.
-  if (!IsCurrentDownloadingInProgress())
-    TryStartingDownloadTask();
+  // If all downloaders are busy, the next download will be triggered when one
+  // of them is finished.
+  TryStartingDownloadTask();
 }
 
 void PlaylistMediaFileDownloadManager::CancelDownloadRequest(
     const std::string& id) {
   VLOG(2) << __func__ << " " << id;
 
-  // Cancel if currently downloading item is id.
-  // Otherwise, GetNextPlaylistItemTarget() will drop canceled one.
-  if (GetCurrentDownloadingPlaylistItemID() == id) {
-    CancelCurrentDownloadingPlaylistItem();
+  base::EraseIf(pending_media_file_creation_jobs_,
+                [&id](const auto& item) { return item.id == id; });
+
+  if (auto* downloader = GetDownloaderFor(id)) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
     TryStartingDownloadTask();
-    return;
   }
 }
 
 void PlaylistMediaFileDownloadManager::CancelAllDownloadRequests() {
-  CancelCurrentDownloadingPlaylistItem();
-  pending_media_file_creation_jobs_ = {};
+  pending_media_file_creation_jobs_.clear();
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress())
+      downloader->RequestCancelCurrentPlaylistGeneration();
+  }
 }
 
 void PlaylistMediaFileDownloadManager::TryStartingDownloadTask() {
-  if (IsCurrentDownloadingInProgress())
-    return;
+  // Positions can change while items wait, so they're looked up once per
+  // pass, and only when there is a downloader to start.
+  absl::optional<PlaylistItemPositions> positions;
+  while (!pending_media_file_creation_jobs_.empty()) {
+    auto* downloader = GetIdleDownloader();
+    if (!downloader)
+      return;
 
-  if (pending_media_file_creation_jobs_.empty())
-    return;
+    if (!positions)
+      positions = delegate_->GetPlaylistItemPositions();
 
-  current_item_ = GetNextPlaylistItemTarget();
-  if (!current_item_)
-    return;
+    auto item = GetNextPlaylistItemTarget(*positions);
+    if (!item)
+      return;
 
-  VLOG(2) << __func__ << ": " << current_item_->title;
+    VLOG(2) << __func__ << ": " << item->title;
 
-  media_file_downloader_->DownloadMediaFileForPlaylistItem(*current_item_,
-                                                           base_dir_);
+    downloader->DownloadMediaFileForPlaylistItem(*item, base_dir_);
+  }
 }
 
 std::unique_ptr<PlaylistItemInfo>
-PlaylistMediaFileDownloadManager::GetNextPlaylistItemTarget() {
-  while (!pending_media_file_creation_jobs_.empty()) {
-    auto playlist_item(std::move(pending_media_file_creation_jobs_.front()));
-    pending_media_file_creation_jobs_.pop();
-
-    if (delegate_->IsValidPlaylistItem(playlist_item.id))
-      return std::make_unique<PlaylistItemInfo>(std::move(playlist_item));
+PlaylistMediaFileDownloadManager::GetNextPlaylistItemTarget(
+    const PlaylistItemPositions& positions) {
+  base::EraseIf(pending_media_file_creation_jobs_, [this](const auto& item) {
+    return !delegate_->IsValidPlaylistItem(item.id);
+  });
+  if (pending_media_file_creation_jobs_.empty())
+    return nullptr;
+
+  auto get_position = [&positions](const std::string& id) {
+    auto it = positions.find(id);
+    return it == positions.end() ? std::numeric_limits<size_t>::max()
+                                 : it->second;
+  };
+
+  auto next = pending_media_file_creation_jobs_.begin();
+  size_t next_position = get_position(next->id);
+  for (auto it = std::next(next); it != pending_media_file_creation_jobs_.end();
+       ++it) {
+    const size_t position = get_position(it->id);
+    if (position < next_position) {
+      next = it;
+      next_position = position;
+    }
   }
 
-  return nullptr;
+  auto playlist_item = std::make_unique<PlaylistItemInfo>(std::move(*next));
+  pending_media_file_creation_jobs_.erase(next);
+  return playlist_item;
 }
 
-std::string
-PlaylistMediaFileDownloadManager::GetCurrentDownloadingPlaylistItemID() const {
-  if (IsCurrentDownloadingInProgress())
-    return media_file_downloader_->current_playlist_id();
-
-  return {};
-}
-
-void PlaylistMediaFileDownloadManager::CancelCurrentDownloadingPlaylistItem() {
-  media_file_downloader_->RequestCancelCurrentPlaylistGeneration();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetIdleDownloader() {
+  for (auto& downloader : media_file_downloaders_) {
+    if (!downloader->in_progress())
+      return downloader.get();
+  }
+  return nullptr;
 }
 
-bool PlaylistMediaFileDownloadManager::IsCurrentDownloadingInProgress() const {
-  return media_file_downloader_->in_progress();
+PlaylistMediaFileDownloader* PlaylistMediaFileDownloadManager::GetDownloaderFor(
+    const std::string& id) {
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress() && downloader->current_playlist_id() == id)
+      return downloader.get();
+  }
+  return nullptr;
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
@@ -119,8 +152,6 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
 
   delegate_->OnMediaFileReady(id, media_file_path);
 
-  current_item_.reset();
-
   base::SequencedTaskRunnerHandle::Get()->PostTask(
       FROM_HERE,
       base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
@@ -133,8 +164,6 @@ void PlaylistMediaFileDownloadManager::OnMediaFileGenerationFailed(
 
   delegate_->OnMediaFileGenerationFailed(id);
 
-  CancelCurrentDownloadingPlaylistItem();
-
   base::SequencedTaskRunnerHandle::Get()->PostTask(
       FROM_HERE,
       base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
@@ -8,8 +8,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "base/containers/queue.h"
+#include "base/containers/flat_map.h"
 #include "brave/components/playlist/playlist_media_file_downloader.h"
 
 namespace base {
@@ -23,12 +24,15 @@ class BrowserContext;
 namespace playlist {
 
 // Download youtube playlist item's audio/video media files.
-// This handles one request at once. So, it has pending queue.
-// And PlaylistMediaFileDownloader does file download task.
-// TODO(simonhong): Download multiple media files simultaneously.
+// Up to |kMaxConcurrentDownloads| requests are handled at once, each by its
+// own PlaylistMediaFileDownloader. Other requests wait in the pending list and
+// are started in the order the items have in their playlists.
 class PlaylistMediaFileDownloadManager
     : public PlaylistMediaFileDownloader::Delegate {
  public:
+  // Maps the ids of playlist items to their positions in their playlists.
+  using PlaylistItemPositions = base::flat_map<std::string, size_t>;
+
   class Delegate {
    public:
     virtual void OnMediaFileDownloadProgressed(
@@ -41,6 +45,9 @@ class PlaylistMediaFileDownloadManager
                                   const std::string& media_file_path) = 0;
     virtual void OnMediaFileGenerationFailed(const std::string& id) = 0;
     virtual bool IsValidPlaylistItem(const std::string& id) = 0;
+    // Returns the positions of all items in the playlists they belong to.
+    // Items at lower positions are downloaded first.
+    virtual PlaylistItemPositions GetPlaylistItemPositions() = 0;
 
    protected:
     virtual ~Delegate() {}
@@ -49,6 +56,8 @@ class PlaylistMediaFileDownloadManager
   static constexpr base::FilePath::CharType kMediaFileName[] =
       FILE_PATH_LITERAL("media_file.mp4");
 
+  static constexpr size_t kMaxConcurrentDownloads = 3;
+
   PlaylistMediaFileDownloadManager(content::BrowserContext* context,
                                    Delegate* delegate,
                                    const base::FilePath& base_dir);
@@ -75,18 +84,17 @@ class PlaylistMediaFileDownloadManager
   void OnMediaFileGenerationFailed(const std::string& id) override;
 
   void TryStartingDownloadTask();
-  std::unique_ptr<PlaylistItemInfo> GetNextPlaylistItemTarget();
-  std::string GetCurrentDownloadingPlaylistItemID() const;
-  void CancelCurrentDownloadingPlaylistItem();
-  bool IsCurrentDownloadingInProgress() const;
+  std::unique_ptr<PlaylistItemInfo> GetNextPlaylistItemTarget(
+      const PlaylistItemPositions& positions);
+  PlaylistMediaFileDownloader* GetIdleDownloader();
+  PlaylistMediaFileDownloader* GetDownloaderFor(const std::string& id);
 
   const base::FilePath base_dir_;
   raw_ptr<Delegate> delegate_;
-  base::queue<PlaylistItemInfo> pending_media_file_creation_jobs_;
-
-  std::unique_ptr<PlaylistItemInfo> current_item_;
+  std::vector<PlaylistItemInfo> pending_media_file_creation_jobs_;
 
-  std::unique_ptr<PlaylistMediaFileDownloader> media_file_downloader_;
+  std::vector<std::unique_ptr<PlaylistMediaFileDownloader>>
+      media_file_downloaders_;
 
   base::WeakPtrFactory<PlaylistMediaFileDownloadManager> weak_factory_{this};
 };
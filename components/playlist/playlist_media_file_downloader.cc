@@ -16,7 +16,6 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/task_runner_util.h"
-#include "base/task/thread_pool.h"
 #include "brave/components/playlist/playlist_constants.h"
 #include "brave/components/playlist/playlist_types.h"
 #include "build/build_config.h"
@@ -50,6 +49,65 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTagForURLLoad() {
       })");
 }
 
+constexpr base::FilePath::CharType kPartialMediaFileInfoExtension[] =
+    FILE_PATH_LITERAL("resume");
+constexpr char kETagKey[] = "etag";
+constexpr char kLastModifiedKey[] = "last_modified";
+
+// Interruptions after which the server is expected to serve the rest of the
+// same file.
+bool IsResumableInterruptReason(download::DownloadInterruptReason reason) {
+  switch (reason) {
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_FAILED:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_TIMEOUT:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_DISCONNECTED:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_SERVER_DOWN:
+    case download::DOWNLOAD_INTERRUPT_REASON_SERVER_FAILED:
+      return true;
+    default:
+      return false;
+  }
+}
+
+absl::optional<PlaylistMediaFileDownloader::PartialMediaFile>
+ReadPartialMediaFile(const base::FilePath& media_file,
+                     const base::FilePath& info_file) {
+  std::string json;
+  if (!base::ReadFileToString(info_file, &json))
+    return absl::nullopt;
+
+  PlaylistMediaFileDownloader::PartialMediaFile partial_file;
+  auto value = base::JSONReader::Read(json);
+  if (value && value->is_dict()) {
+    const auto& dict = value->GetDict();
+    if (const auto* etag = dict.FindString(kETagKey))
+      partial_file.etag = *etag;
+    if (const auto* last_modified = dict.FindString(kLastModifiedKey))
+      partial_file.last_modified = *last_modified;
+  }
+
+  // Range requests are only made with a validator, see
+  // download::CreateResourceRequest().
+  if ((partial_file.etag.empty() && partial_file.last_modified.empty()) ||
+      !base::GetFileSize(media_file, &partial_file.size) ||
+      partial_file.size <= 0) {
+    base::DeleteFile(info_file);
+    return absl::nullopt;
+  }
+
+  return partial_file;
+}
+
+void WritePartialMediaFileInfo(const base::FilePath& partial_path,
+                               const base::FilePath& media_file,
+                               const base::FilePath& info_file,
+                               const std::string& json) {
+  if (partial_path != media_file && !base::Move(partial_path, media_file))
+    return;
+
+  base::WriteFile(info_file, json);
+}
+
 }  // namespace
 
 PlaylistMediaFileDownloader::PlaylistMediaFileDownloader(
@@ -126,9 +184,25 @@ void PlaylistMediaFileDownloader::DetachCachedFile(
           download::DownloadInterruptReason::DOWNLOAD_INTERRUPT_REASON_NONE &&
       item->IsDone()) {
     will_be_detached->MarkAsComplete();
-  } else {
+    return;
+  }
+
+  base::OnceClosure keep_partial_file;
+  if (item->GetState() == download::DownloadItem::INTERRUPTED &&
+      IsResumableInterruptReason(item->GetLastReason())) {
+    keep_partial_file = GetKeepPartialMediaFileTask(item);
+  }
+
+  if (!keep_partial_file) {
     will_be_detached->Remove();
+    return;
   }
+
+  // Keep the partial file for the next attempt. The item is destroyed first
+  // so that nothing resumes it, and the file is moved on the sequence where
+  // the download system released it.
+  will_be_detached.reset();
+  task_runner()->PostTask(FROM_HERE, std::move(keep_partial_file));
 }
 
 void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
@@ -140,7 +214,7 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (item.media_file_cached) {
     DVLOG(2) << __func__ << ": media file is already downloaded";
-    NotifySucceed(current_item_->id, current_item_->media_file_path);
+    NotifySucceed(item.id, item.media_file_path);
     return;
   }
 
@@ -166,7 +240,13 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (GURL media_url(current_item_->media_src); media_url.is_valid()) {
     playlist_dir_path_ = base_dir.AppendASCII(current_item_->id);
-    DownloadMediaFile(media_url);
+    task_runner()->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&ReadPartialMediaFile, GetMediaFilePath(),
+                       GetPartialMediaFileInfoPath()),
+        base::BindOnce(&PlaylistMediaFileDownloader::OnGotPartialMediaFile,
+                       weak_factory_.GetWeakPtr(), current_item_->id,
+                       media_url));
   } else {
     DVLOG(2) << __func__ << ": media file is empty";
     NotifyFail(current_item_->id);
@@ -176,18 +256,19 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 void PlaylistMediaFileDownloader::OnDownloadCreated(
     download::DownloadItem* item) {
   DVLOG(2) << __func__;
-  DCHECK(current_item_) << "This shouldn't happen as we unobserve the manager "
-                           "when a process for an item is done";
-  DCHECK_EQ(item->GetGuid(), current_item_->id);
-
   DCHECK(!download_item_observation_.IsObservingSource(item));
   download_item_observation_.AddObservation(item);
+
+  // The request was canceled before the download started.
+  if (!current_item_ || item->GetGuid() != current_item_->id)
+    ScheduleToDetachCachedFile(item);
 }
 
 void PlaylistMediaFileDownloader::OnDownloadUpdated(
     download::DownloadItem* item) {
-  if (!current_item_) {
-    // Download could be already finished. This seems to be late async callback.
+  if (!current_item_ || item->GetGuid() != current_item_->id) {
+    // Download could be already finished or canceled. This seems to be late
+    // async callback.
     return;
   }
 
@@ -196,6 +277,8 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
     LOG(ERROR) << __func__ << ": Download interrupted - reason: "
                << download::DownloadInterruptReasonToString(
                       item->GetLastReason());
+    // The partial file is kept when the item is detached, if possible.
+    DeletePartialMediaFileInfo();
     ScheduleToDetachCachedFile(item);
     OnMediaFileDownloaded({});
     return;
@@ -208,8 +291,9 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
       item->PercentComplete(), time_remaining);
 
   if (item->IsDone()) {
+    DeletePartialMediaFileInfo();
     ScheduleToDetachCachedFile(item);
-    OnMediaFileDownloaded(playlist_dir_path_.Append(media_file_name_));
+    OnMediaFileDownloaded(GetMediaFilePath());
     return;
   }
 }
@@ -220,13 +304,34 @@ void PlaylistMediaFileDownloader::OnDownloadRemoved(
       << "`item` was removed out of this class. This could cause flaky tests";
 }
 
-void PlaylistMediaFileDownloader::DownloadMediaFile(const GURL& url) {
+void PlaylistMediaFileDownloader::OnGotPartialMediaFile(
+    const std::string& id,
+    const GURL& url,
+    absl::optional<PartialMediaFile> partial_file) {
+  // Canceled while looking for the partial file.
+  if (!current_item_ || current_item_->id != id)
+    return;
+
+  DownloadMediaFile(url, partial_file);
+}
+
+void PlaylistMediaFileDownloader::DownloadMediaFile(
+    const GURL& url,
+    const absl::optional<PartialMediaFile>& partial_file) {
   DVLOG(2) << __func__ << ": " << url.spec();
 
-  const base::FilePath file_path = playlist_dir_path_.Append(media_file_name_);
   auto params = std::make_unique<download::DownloadUrlParameters>(
       url, GetNetworkTrafficAnnotationTagForURLLoad());
-  params->set_file_path(file_path);
+  params->set_file_path(GetMediaFilePath());
+  if (partial_file) {
+    DVLOG(2) << __func__ << ": resuming from " << partial_file->size;
+    // Requests the missing range only if the file is still the same. If it
+    // changed, the download fails and the partial file is removed so that the
+    // next attempt starts over.
+    params->set_offset(partial_file->size);
+    params->set_etag(partial_file->etag);
+    params->set_last_modified(partial_file->last_modified);
+  }
   params->set_guid(current_item_->id);
   params->set_transient(true);
   params->set_require_safety_checks(false);
@@ -251,15 +356,59 @@ void PlaylistMediaFileDownloader::OnMediaFileDownloaded(base::FilePath path) {
   NotifySucceed(current_item_->id, path.AsUTF8Unsafe());
 }
 
+base::OnceClosure PlaylistMediaFileDownloader::GetKeepPartialMediaFileTask(
+    download::DownloadItem* item) {
+  // The target is the media file, see DownloadMediaFile().
+  const base::FilePath media_file = item->GetTargetFilePath();
+  if (item->GetFullPath().empty() || media_file.empty() ||
+      item->GetReceivedBytes() <= 0 ||
+      (item->GetETag().empty() && item->GetLastModifiedTime().empty())) {
+    return base::OnceClosure();
+  }
+
+  base::Value::Dict info;
+  info.Set(kETagKey, item->GetETag());
+  info.Set(kLastModifiedKey, item->GetLastModifiedTime());
+  std::string json;
+  base::JSONWriter::Write(info, &json);
+
+  return base::BindOnce(
+      &WritePartialMediaFileInfo, item->GetFullPath(), media_file,
+      media_file.AddExtension(kPartialMediaFileInfoExtension), std::move(json));
+}
+
+void PlaylistMediaFileDownloader::DeletePartialMediaFileInfo() {
+  task_runner()->PostTask(
+      FROM_HERE, base::GetDeleteFileCallback(GetPartialMediaFileInfoPath()));
+}
+
+base::FilePath PlaylistMediaFileDownloader::GetMediaFilePath() const {
+  return playlist_dir_path_.Append(media_file_name_);
+}
+
+base::FilePath PlaylistMediaFileDownloader::GetPartialMediaFileInfoPath()
+    const {
+  return GetMediaFilePath().AddExtension(kPartialMediaFileInfoExtension);
+}
+
 void PlaylistMediaFileDownloader::RequestCancelCurrentPlaylistGeneration() {
+  // Stop the download as well, so that this downloader can take the next
+  // item right away.
+  if (current_item_ && download_manager_) {
+    if (auto* item = download_manager_->GetDownloadByGuid(current_item_->id);
+        item && download_item_observation_.IsObservingSource(item)) {
+      ScheduleToDetachCachedFile(item);
+    }
+  }
+
   ResetDownloadStatus();
 }
 
 base::SequencedTaskRunner* PlaylistMediaFileDownloader::task_runner() {
   if (!task_runner_) {
-    task_runner_ = base::ThreadPool::CreateSequencedTaskRunner(
-        {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
-         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+    // Media files are written by the download system on this sequence, so
+    // partial files are only touched once it is done with them.
+    task_runner_ = download::GetDownloadTaskRunner();
   }
   return task_runner_.get();
 }
@@ -19,6 +19,7 @@
 #include "brave/components/playlist/playlist_types.h"
 #include "components/download/public/common/download_item.h"
 #include "components/download/public/common/simple_download_manager.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class FilePath;
@@ -44,6 +45,9 @@ class GURL;
 namespace playlist {
 
 // Handle one Playlist at once.
+// When a download is interrupted by a network error, the partial media file is
+// kept together with the validators of the response, so that the next attempt
+// for the same item only requests the missing range.
 class PlaylistMediaFileDownloader
     : public download::SimpleDownloadManager::Observer,
       public download::DownloadItem::Observer {
@@ -91,10 +95,25 @@ class PlaylistMediaFileDownloader
   void OnDownloadUpdated(download::DownloadItem* item) override;
   void OnDownloadRemoved(download::DownloadItem* item) override;
 
+  // What is needed to resume an interrupted download.
+  struct PartialMediaFile {
+    int64_t size = 0;
+    std::string etag;
+    std::string last_modified;
+  };
+
  private:
   void ResetDownloadStatus();
-  void DownloadMediaFile(const GURL& url);
+  void OnGotPartialMediaFile(const std::string& id,
+                             const GURL& url,
+                             absl::optional<PartialMediaFile> partial_file);
+  void DownloadMediaFile(const GURL& url,
+                         const absl::optional<PartialMediaFile>& partial_file);
   void OnMediaFileDownloaded(base::FilePath path);
+  base::OnceClosure GetKeepPartialMediaFileTask(download::DownloadItem* item);
+  void DeletePartialMediaFileInfo();
+  base::FilePath GetMediaFilePath() const;
+  base::FilePath GetPartialMediaFileInfoPath() const;
 
   void NotifyFail(const std::string& id);
   void NotifySucceed(const std::string& id, const std::string& media_file_path);
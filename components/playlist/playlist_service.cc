@@ -6,6 +6,7 @@
 #include "brave/components/playlist/playlist_service.h"
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "base/bind.h"
@@ -38,6 +39,18 @@ constexpr base::FilePath::StringPieceType kBaseDirName =
 constexpr base::FilePath::StringPieceType kThumbnailFileName =
     FILE_PATH_LITERAL("thumbnail");
 
+constexpr base::FilePath::StringPieceType kDatabaseFileName =
+    FILE_PATH_LITERAL("playlist.db");
+
+// Returns the value stored for the dict pref at |path|. Unlike
+// PrefService::GetDict(), the registered default isn't returned when nothing
+// is stored.
+base::Value::Dict GetStoredDictPref(PrefService* prefs, const char* path) {
+  if (!prefs->HasPrefPath(path))
+    return base::Value::Dict();
+  return prefs->GetDict(path).Clone();
+}
+
 std::vector<base::FilePath> GetOrphanedPaths(
     const base::FilePath& base_dir,
     const base::flat_set<std::string>& ids) {
@@ -55,7 +68,11 @@ std::vector<base::FilePath> GetOrphanedPaths(
 PlaylistService::PlaylistService(content::BrowserContext* context,
                                  MediaDetectorComponentManager* manager)
     : base_dir_(context->GetPath().Append(kBaseDirName)),
-      prefs_(user_prefs::UserPrefs::Get(context)) {
+      prefs_(user_prefs::UserPrefs::Get(context)),
+      database_(base::ThreadPool::CreateSequencedTaskRunner(
+                    {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+                     base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+                base_dir_.Append(kDatabaseFileName)) {
   content::URLDataSource::Add(context,
                               std::make_unique<PlaylistDataSource>(this));
   media_file_download_manager_ =
@@ -66,12 +83,15 @@ PlaylistService::PlaylistService(content::BrowserContext* context,
   download_request_manager_ =
       std::make_unique<PlaylistDownloadRequestManager>(context, manager);
 
-  // This is for cleaning up malformed items during development. Once we
-  // release Playlist feature officially, we should migrate items
-  // instead of deleting them.
-  CleanUpMalformedPlaylistItems();
-
-  CleanUpOrphanedPlaylistItemDirs();
+  // Playlists used to be stored in prefs. They are imported when the database
+  // is created and cleared from prefs once loaded. The registered default of
+  // kPlaylistsPref is left out, as its empty default playlist would replace
+  // the stored one on every start.
+  database_.AsyncCall(&PlaylistDatabase::Init)
+      .WithArgs(GetStoredDictPref(prefs_, kPlaylistsPref),
+                GetStoredDictPref(prefs_, kPlaylistItemsPref))
+      .Then(base::BindOnce(&PlaylistService::OnDatabaseInitialized,
+                           weak_factory_.GetWeakPtr()));
 }
 
 PlaylistService::~PlaylistService() = default;
@@ -82,6 +102,65 @@ void PlaylistService::Shutdown() {
   thumbnail_downloader_.reset();
   download_request_manager_.reset();
   task_runner_.reset();
+  pending_tasks_.clear();
+}
+
+void PlaylistService::OnDatabaseInitialized(bool success) {
+  if (!success) {
+    // Keep using the prefs as storage, so that changes made in this session
+    // are imported when the database can be opened again.
+    LOG(ERROR) << __func__ << " Failed to open the playlist database";
+    use_prefs_storage_ = true;
+    playlists_ = prefs_->GetDict(kPlaylistsPref).Clone();
+    items_ = prefs_->GetDict(kPlaylistItemsPref).Clone();
+    OnPlaylistsLoaded();
+    return;
+  }
+
+  database_.AsyncCall(&PlaylistDatabase::Load)
+      .Then(base::BindOnce(&PlaylistService::OnDatabaseLoaded,
+                           weak_factory_.GetWeakPtr()));
+}
+
+void PlaylistService::OnDatabaseLoaded(PlaylistDatabase::Contents contents) {
+  playlists_ = std::move(contents.playlists);
+  items_ = std::move(contents.items);
+
+  // Imported into the database by now.
+  prefs_->ClearPref(kPlaylistsPref);
+  prefs_->ClearPref(kPlaylistItemsPref);
+
+  // A new database starts out empty, unless it imported stored prefs.
+  if (!playlists_.FindDict(kDefaultPlaylistID))
+    CreatePlaylistImpl(kDefaultPlaylistID, "");
+
+  OnPlaylistsLoaded();
+}
+
+void PlaylistService::OnPlaylistsLoaded() {
+  ready_ = true;
+
+  // This is for cleaning up malformed items during development. Once we
+  // release Playlist feature officially, we should migrate items
+  // instead of deleting them.
+  CleanUpMalformedPlaylistItems();
+
+  CleanUpOrphanedPlaylistItemDirs();
+
+  NotifyPlaylistChanged({PlaylistChangeParams::Type::kAllLoaded, ""});
+
+  auto pending_tasks = std::move(pending_tasks_);
+  for (auto& task : pending_tasks)
+    std::move(task).Run();
+}
+
+void PlaylistService::RunWhenReady(base::OnceClosure task) {
+  if (ready_) {
+    std::move(task).Run();
+    return;
+  }
+
+  pending_tasks_.push_back(std::move(task));
 }
 
 void PlaylistService::AddMediaFilesFromContentsToPlaylist(
@@ -123,8 +202,14 @@ void PlaylistService::AddMediaFilesFromPageToPlaylist(
 bool PlaylistService::AddItemsToPlaylist(
     const std::string& playlist_id,
     const std::vector<std::string>& item_ids) {
-  ScopedDictPrefUpdate playlists_update(prefs_, kPlaylistsPref);
-  base::Value::Dict* target_playlist = playlists_update->FindDict(playlist_id);
+  if (!ready_) {
+    RunWhenReady(
+        base::BindOnce(base::IgnoreResult(&PlaylistService::AddItemsToPlaylist),
+                       weak_factory_.GetWeakPtr(), playlist_id, item_ids));
+    return true;
+  }
+
+  base::Value::Dict* target_playlist = playlists_.FindDict(playlist_id);
   if (!target_playlist) {
     LOG(ERROR) << __func__ << " Playlist " << playlist_id << " not found";
     return false;
@@ -147,7 +232,7 @@ bool PlaylistService::AddItemsToPlaylist(
     ids_list->Append(id);
   }
 
-  target_playlist->Set(kPlaylistItemsKey, std::move(*ids_list));
+  SavePlaylist(*target_playlist);
   return true;
 }
 
@@ -158,9 +243,15 @@ bool PlaylistService::RemoveItemFromPlaylist(const PlaylistId& playlist_id,
 
   DCHECK(!item_id->empty());
 
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(
+        base::IgnoreResult(&PlaylistService::RemoveItemFromPlaylist),
+        weak_factory_.GetWeakPtr(), playlist_id, item_id, remove_item));
+    return true;
+  }
+
   {
-    ScopedDictPrefUpdate playlists_update(prefs_, kPlaylistsPref);
-    base::Value::Dict* target_playlist = playlists_update->FindDict(
+    base::Value::Dict* target_playlist = playlists_.FindDict(
         playlist_id->empty() ? kDefaultPlaylistID : *playlist_id);
     if (!target_playlist) {
       VLOG(2) << __func__ << " Playlist " << playlist_id << " not found";
@@ -180,7 +271,7 @@ bool PlaylistService::RemoveItemFromPlaylist(const PlaylistId& playlist_id,
 
     item_ids->erase(it);
 
-    target_playlist->Set(kPlaylistItemsKey, std::move(*item_ids));
+    SavePlaylist(*target_playlist);
   }
 
   // TODO(sko) Once we can support to share an item between playlists, we should
@@ -198,6 +289,13 @@ void PlaylistService::AddMediaFilesFromItems(
   if (params.empty())
     return;
 
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::AddMediaFilesFromItems,
+                                weak_factory_.GetWeakPtr(), playlist_id, cache,
+                                params));
+    return;
+  }
+
   std::vector<std::string> ids;
   base::ranges::transform(params, std::back_inserter(ids),
                           [](const auto& item) { return item.id; });
@@ -219,10 +317,8 @@ void PlaylistService::NotifyPlaylistChanged(
     obs.OnPlaylistStatusChanged(params);
 }
 
-bool PlaylistService::HasPrefStorePlaylistItem(const std::string& id) const {
-  const auto& items = prefs_->GetDict(kPlaylistItemsPref);
-  const base::Value::Dict* playlist_info = items.FindDict(id);
-  return !!playlist_info;
+bool PlaylistService::HasPlaylistItem(const std::string& id) const {
+  return !!items_.FindDict(id);
 }
 
 void PlaylistService::DownloadMediaFile(const PlaylistItemInfo& info) {
@@ -248,7 +344,8 @@ content::WebContents* PlaylistService::GetBackgroundWebContentsForTesting() {
 
 std::string PlaylistService::GetDefaultSaveTargetListID() {
   auto id = prefs_->GetString(kPlaylistDefaultSaveTargetListID);
-  if (!prefs_->GetDict(kPlaylistsPref).contains(id)) {
+  // Playlists other than the default one aren't known before loading.
+  if (ready_ && !playlists_.contains(id)) {
     prefs_->SetString(kPlaylistDefaultSaveTargetListID, kDefaultPlaylistID);
     id = kDefaultPlaylistID;
   }
@@ -257,13 +354,35 @@ std::string PlaylistService::GetDefaultSaveTargetListID() {
 
 void PlaylistService::UpdatePlaylistItemValue(const std::string& id,
                                               base::Value value) {
-  ScopedDictPrefUpdate playlist_items(prefs_, kPlaylistItemsPref);
-  playlist_items->Set(id, std::move(value));
+  DCHECK(value.is_dict());
+  if (use_prefs_storage_) {
+    ScopedDictPrefUpdate(prefs_, kPlaylistItemsPref)
+        ->Set(id, value.GetDict().Clone());
+  } else {
+    database_.AsyncCall(&PlaylistDatabase::SetItem)
+        .WithArgs(id, value.GetDict().Clone());
+  }
+  items_.Set(id, std::move(value));
 }
 
 void PlaylistService::RemovePlaylistItemValue(const std::string& id) {
-  ScopedDictPrefUpdate playlist_items(prefs_, kPlaylistItemsPref);
-  playlist_items->Remove(id);
+  items_.Remove(id);
+  if (use_prefs_storage_)
+    ScopedDictPrefUpdate(prefs_, kPlaylistItemsPref)->Remove(id);
+  else
+    database_.AsyncCall(&PlaylistDatabase::DeleteItem).WithArgs(id);
+}
+
+void PlaylistService::SavePlaylist(const base::Value::Dict& playlist) {
+  if (use_prefs_storage_) {
+    const std::string* id = playlist.FindString(kPlaylistIDKey);
+    DCHECK(id);
+    ScopedDictPrefUpdate(prefs_, kPlaylistsPref)->Set(*id, playlist.Clone());
+    return;
+  }
+
+  database_.AsyncCall(&PlaylistDatabase::SetPlaylist)
+      .WithArgs(playlist.Clone());
 }
 
 void PlaylistService::CreatePlaylistItem(const PlaylistItemInfo& params,
@@ -326,7 +445,7 @@ void PlaylistService::OnThumbnailDownloaded(const std::string& id,
     return;
   }
 
-  const auto* value = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  const auto* value = items_.FindDict(id);
   DCHECK(value);
   if (value) {
     base::Value::Dict copied_value = value->Clone();
@@ -342,27 +461,37 @@ void PlaylistService::CreatePlaylist(PlaylistInfo& info) {
     info.id = base::Token::CreateRandom().ToString();
   } while (info.id == kDefaultPlaylistID);
 
+  RunWhenReady(base::BindOnce(&PlaylistService::CreatePlaylistImpl,
+                              weak_factory_.GetWeakPtr(), info.id, info.name));
+}
+
+void PlaylistService::CreatePlaylistImpl(const std::string& id,
+                                         const std::string& name) {
   base::Value::Dict playlist;
-  playlist.Set(kPlaylistIDKey, info.id);
-  playlist.Set(kPlaylistNameKey, info.name);
+  playlist.Set(kPlaylistIDKey, id);
+  playlist.Set(kPlaylistNameKey, name);
   playlist.Set(kPlaylistItemsKey, base::Value::List());
 
-  ScopedDictPrefUpdate playlists_update(prefs_, kPlaylistsPref);
-  playlists_update->Set(info.id, std::move(playlist));
+  SavePlaylist(playlist);
+  playlists_.Set(id, std::move(playlist));
 
-  NotifyPlaylistChanged({PlaylistChangeParams::Type::kListCreated, info.id});
+  NotifyPlaylistChanged({PlaylistChangeParams::Type::kListCreated, id});
 }
 
 void PlaylistService::RemovePlaylist(const std::string& playlist_id) {
   if (playlist_id == kDefaultPlaylistID)
     return;
 
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::RemovePlaylist,
+                                weak_factory_.GetWeakPtr(), playlist_id));
+    return;
+  }
+
   DCHECK(!playlist_id.empty());
   base::Value::List id_list;
   {
-    ScopedDictPrefUpdate playlists_update(prefs_, kPlaylistsPref);
-    base::Value::Dict* target_playlist =
-        playlists_update->FindDict(playlist_id);
+    base::Value::Dict* target_playlist = playlists_.FindDict(playlist_id);
     if (!target_playlist) {
       LOG(ERROR) << __func__ << " Playlist " << playlist_id << " not found";
       return;
@@ -376,7 +505,13 @@ void PlaylistService::RemovePlaylist(const std::string& playlist_id) {
     }
 
     id_list = std::move(*item_ids);
-    playlists_update->Remove(playlist_id);
+    playlists_.Remove(playlist_id);
+    if (use_prefs_storage_) {
+      ScopedDictPrefUpdate(prefs_, kPlaylistsPref)->Remove(playlist_id);
+    } else {
+      database_.AsyncCall(&PlaylistDatabase::DeletePlaylist)
+          .WithArgs(playlist_id);
+    }
   }
 
   // TODO(sko) Iterating this will cause a callback to be called a lot of
@@ -390,7 +525,7 @@ void PlaylistService::RemovePlaylist(const std::string& playlist_id) {
 
 std::vector<PlaylistItemInfo> PlaylistService::GetAllPlaylistItems() {
   std::vector<PlaylistItemInfo> items;
-  for (const auto it : prefs_->GetDict(kPlaylistItemsPref)) {
+  for (const auto it : items_) {
     items.push_back(GetPlaylistItemInfoFromValue(it.second.GetDict()));
   }
 
@@ -399,7 +534,7 @@ std::vector<PlaylistItemInfo> PlaylistService::GetAllPlaylistItems() {
 
 PlaylistItemInfo PlaylistService::GetPlaylistItem(const std::string& id) {
   DCHECK(!id.empty());
-  const auto* item_value = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  const auto* item_value = items_.FindDict(id);
   DCHECK(item_value);
   if (!item_value)
     return {};
@@ -409,12 +544,11 @@ PlaylistItemInfo PlaylistService::GetPlaylistItem(const std::string& id) {
 
 absl::optional<PlaylistInfo> PlaylistService::GetPlaylist(
     const std::string& id) {
-  const auto& playlists = prefs_->GetDict(kPlaylistsPref);
-  if (!playlists.contains(id)) {
+  if (!playlists_.contains(id)) {
     LOG(ERROR) << __func__ << " playlist with id<" << id << "> not found";
     return {};
   }
-  auto* playlist = playlists.FindDict(id);
+  auto* playlist = playlists_.FindDict(id);
   DCHECK(playlist);
 
   PlaylistInfo info;
@@ -428,8 +562,7 @@ absl::optional<PlaylistInfo> PlaylistService::GetPlaylist(
 
 std::vector<PlaylistInfo> PlaylistService::GetAllPlaylists() {
   std::vector<PlaylistInfo> result;
-  const auto& playlists = prefs_->GetDict(kPlaylistsPref);
-  for (const auto [id, playlist_value] : playlists) {
+  for (const auto [id, playlist_value] : playlists_) {
     DCHECK(playlist_value.is_dict());
     const auto& playlist = playlist_value.GetDict();
 
@@ -445,6 +578,44 @@ std::vector<PlaylistInfo> PlaylistService::GetAllPlaylists() {
   return result;
 }
 
+void PlaylistService::GetPlaylistItems(const std::string& playlist_id,
+                                       size_t offset,
+                                       size_t count,
+                                       GetPlaylistItemsCallback callback) {
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::GetPlaylistItems,
+                                weak_factory_.GetWeakPtr(), playlist_id,
+                                offset, count, std::move(callback)));
+    return;
+  }
+
+  if (use_prefs_storage_) {
+    std::vector<PlaylistItemInfo> items;
+    const auto* playlist = playlists_.FindDict(playlist_id);
+    const auto* item_ids =
+        playlist ? playlist->FindList(kPlaylistItemsKey) : nullptr;
+    const size_t size = item_ids ? item_ids->size() : 0;
+    for (size_t i = offset; i < size && items.size() < count; i++) {
+      if (const auto* item = items_.FindDict((*item_ids)[i].GetString()))
+        items.push_back(GetPlaylistItemInfoFromValue(*item));
+    }
+    std::move(callback).Run(std::move(items));
+    return;
+  }
+
+  database_.AsyncCall(&PlaylistDatabase::GetPlaylistItems)
+      .WithArgs(playlist_id, offset, count)
+      .Then(base::BindOnce(
+          [](GetPlaylistItemsCallback callback,
+             std::vector<base::Value::Dict> values) {
+            std::vector<PlaylistItemInfo> items;
+            for (const auto& value : values)
+              items.push_back(GetPlaylistItemInfoFromValue(value));
+            std::move(callback).Run(std::move(items));
+          },
+          std::move(callback)));
+}
+
 void PlaylistService::FindMediaFilesFromContents(
     content::WebContents* contents,
     FindMediaFilesCallback callback) {
@@ -456,7 +627,13 @@ void PlaylistService::FindMediaFilesFromContents(
 }
 
 void PlaylistService::RecoverPlaylistItem(const std::string& id) {
-  const auto* playlist_value = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::RecoverPlaylistItem,
+                                weak_factory_.GetWeakPtr(), id));
+    return;
+  }
+
+  const auto* playlist_value = items_.FindDict(id);
   if (!playlist_value) {
     LOG(ERROR) << __func__ << ": Invalid playlist id for recovery: " << id;
     return;
@@ -527,7 +704,13 @@ void PlaylistService::DeletePlaylistItemData(const std::string& id) {
 }
 
 void PlaylistService::DeletePlaylistLocalData(const std::string& id) {
-  const auto* item_value_ptr = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::DeletePlaylistLocalData,
+                                weak_factory_.GetWeakPtr(), id));
+    return;
+  }
+
+  const auto* item_value_ptr = items_.FindDict(id);
   base::Value::Dict item = item_value_ptr->Clone();
   item.Set(kPlaylistItemMediaFileCachedKey, false);
 
@@ -550,12 +733,22 @@ void PlaylistService::DeletePlaylistLocalData(const std::string& id) {
 void PlaylistService::DeleteAllPlaylistItems() {
   VLOG(2) << __func__;
 
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::DeleteAllPlaylistItems,
+                                weak_factory_.GetWeakPtr()));
+    return;
+  }
+
   // Cancel currently generated playlist if needed and pending thumbnail
   // download jobs.
   media_file_download_manager_->CancelAllDownloadRequests();
   thumbnail_downloader_->CancelAllDownloadRequests();
 
-  prefs_->ClearPref(kPlaylistItemsPref);
+  items_.clear();
+  if (use_prefs_storage_)
+    prefs_->ClearPref(kPlaylistItemsPref);
+  else
+    database_.AsyncCall(&PlaylistDatabase::DeleteAllItems);
 
   NotifyPlaylistChanged({PlaylistChangeParams::Type::kAllDeleted, ""});
 
@@ -590,7 +783,7 @@ void PlaylistService::OnMediaFileReady(const std::string& id,
   VLOG(2) << __func__ << ": " << id << " " << media_file_path;
   DCHECK(IsValidPlaylistItem(id));
 
-  const auto* item_value_ptr = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  const auto* item_value_ptr = items_.FindDict(id);
   base::Value::Dict item = item_value_ptr->Clone();
   item.Set(kPlaylistItemMediaFileCachedKey, true);
   item.Set(kPlaylistItemMediaFilePathKey, "file://" + media_file_path);
@@ -604,7 +797,7 @@ void PlaylistService::OnMediaFileGenerationFailed(const std::string& id) {
 
   DCHECK(IsValidPlaylistItem(id));
 
-  const auto* item_value_ptr = prefs_->GetDict(kPlaylistItemsPref).FindDict(id);
+  const auto* item_value_ptr = items_.FindDict(id);
   base::Value::Dict item = item_value_ptr->Clone();
 
   item.Set(kPlaylistItemMediaFileCachedKey, false);
@@ -616,7 +809,24 @@ void PlaylistService::OnMediaFileGenerationFailed(const std::string& id) {
 }
 
 bool PlaylistService::IsValidPlaylistItem(const std::string& id) {
-  return HasPrefStorePlaylistItem(id);
+  return HasPlaylistItem(id);
+}
+
+PlaylistMediaFileDownloadManager::PlaylistItemPositions
+PlaylistService::GetPlaylistItemPositions() {
+  std::vector<std::pair<std::string, size_t>> positions;
+  for (const auto it : playlists_) {
+    const auto* item_ids = it.second.GetDict().FindList(kPlaylistItemsKey);
+    if (!item_ids)
+      continue;
+
+    for (size_t i = 0; i < item_ids->size(); i++)
+      positions.emplace_back((*item_ids)[i].GetString(), i);
+  }
+
+  // An item in several playlists keeps its position in the first one.
+  return PlaylistMediaFileDownloadManager::PlaylistItemPositions(
+      std::move(positions));
 }
 
 void PlaylistService::OnGetOrphanedPaths(
@@ -635,7 +845,7 @@ void PlaylistService::OnGetOrphanedPaths(
 
 void PlaylistService::CleanUpMalformedPlaylistItems() {
   if (base::ranges::none_of(
-          prefs_->GetDict(kPlaylistItemsPref),
+          items_,
           /* has_malformed_data = */ [](const auto& pair) {
             auto* dict = pair.second.GetIfDict();
             DCHECK(dict);
@@ -646,8 +856,17 @@ void PlaylistService::CleanUpMalformedPlaylistItems() {
     return;
   }
 
-  for (const auto* pref_key : {kPlaylistsPref, kPlaylistItemsPref})
-    prefs_->ClearPref(pref_key);
+  items_.clear();
+  playlists_.clear();
+  if (use_prefs_storage_) {
+    prefs_->ClearPref(kPlaylistsPref);
+    prefs_->ClearPref(kPlaylistItemsPref);
+  } else {
+    database_.AsyncCall(&PlaylistDatabase::DeleteAll);
+  }
+
+  // Only the default playlist remains, as with empty prefs.
+  CreatePlaylistImpl(kDefaultPlaylistID, "");
 }
 
 void PlaylistService::CleanUpOrphanedPlaylistItemDirs() {
@@ -690,6 +909,12 @@ bool PlaylistService::GetMediaPath(const std::string& id,
 bool PlaylistService::MoveItem(const PlaylistId& from,
                                const PlaylistId& to,
                                const PlaylistItemId& item) {
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(base::IgnoreResult(&PlaylistService::MoveItem),
+                                weak_factory_.GetWeakPtr(), from, to, item));
+    return true;
+  }
+
   if (!RemoveItemFromPlaylist(from, item, /* remove_item = */ false)) {
     LOG(ERROR) << "Failed to remove item from playlist";
     return false;
@@ -709,6 +934,12 @@ bool PlaylistService::MoveItem(const PlaylistId& from,
 }
 
 void PlaylistService::UpdateItem(const PlaylistItemInfo& item) {
+  if (!ready_) {
+    RunWhenReady(base::BindOnce(&PlaylistService::UpdateItem,
+                                weak_factory_.GetWeakPtr(), item));
+    return;
+  }
+
   UpdatePlaylistItemValue(item.id,
                           base::Value(GetValueFromPlaylistItemInfo(item)));
 
@@ -14,7 +14,9 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
+#include "base/threading/sequence_bound.h"
 #include "base/values.h"
+#include "brave/components/playlist/playlist_database.h"
 #include "brave/components/playlist/playlist_download_request_manager.h"
 #include "brave/components/playlist/playlist_media_file_download_manager.h"
 #include "brave/components/playlist/playlist_thumbnail_downloader.h"
@@ -50,7 +52,7 @@ class MediaDetectorComponentManager;
 // PlaylistDownloadRequestManager. PlaylistService owns all these managers. This
 // notifies each playlist's status to users via PlaylistServiceObserver.
 //
-//                  Service│ Request             Update prefs/Create dir
+//                  Service│ Request                Update db/Create dir
 //                         │    │                       ▲ │
 //   DownloadRequestManager│    └─► Find Media files ───┘ │
 //                         │                              │
@@ -67,6 +69,10 @@ class MediaDetectorComponentManager;
 // PlaylistMediaFileDownloadManager and PlaylistThumbnailDownloader. When each
 // of data is ready to use it's notified to client. You can see all notification
 // type - PlaylistItemChangeParams::Type.
+//
+// Playlists and items are stored in PlaylistDatabase and mirrored in memory
+// once loaded, which is notified with kAllLoaded. Until then, getters return
+// nothing and changes are either applied after loading or fail.
 class PlaylistService : public KeyedService,
                         public PlaylistMediaFileDownloadManager::Delegate,
                         public PlaylistThumbnailDownloader::Delegate {
@@ -91,6 +97,18 @@ class PlaylistService : public KeyedService,
   absl::optional<PlaylistInfo> GetPlaylist(const std::string& id);
   std::vector<PlaylistInfo> GetAllPlaylists();
 
+  // Gets up to |count| items of |playlist_id| starting at |offset| from the
+  // database, so that a long playlist can be shown a page at a time.
+  using GetPlaylistItemsCallback =
+      base::OnceCallback<void(std::vector<PlaylistItemInfo>)>;
+  void GetPlaylistItems(const std::string& playlist_id,
+                        size_t offset,
+                        size_t count,
+                        GetPlaylistItemsCallback callback);
+
+  // Whether playlists have been loaded from the database.
+  bool is_ready() const { return ready_; }
+
   // Finds media files from |contents| or |url| and adds them to given
   // |playlist_id|.
   void AddMediaFilesFromContentsToPlaylist(const std::string& playlist_id,
@@ -116,7 +134,9 @@ class PlaylistService : public KeyedService,
 
   void RecoverPlaylistItem(const std::string& id);
 
-  // Add |item_ids| to playlist's item list
+  // Add |item_ids| to playlist's item list. Like RemoveItemFromPlaylist() and
+  // MoveItem(), this returns true without doing anything yet when called
+  // before playlists are loaded, and runs once they are.
   bool AddItemsToPlaylist(const std::string& playlist_id,
                           const std::vector<std::string>& item_ids);
 
@@ -176,6 +196,8 @@ class PlaylistService : public KeyedService,
                         const std::string& media_file_path) override;
   void OnMediaFileGenerationFailed(const std::string& id) override;
   bool IsValidPlaylistItem(const std::string& id) override;
+  PlaylistMediaFileDownloadManager::PlaylistItemPositions
+  GetPlaylistItemPositions() override;
 
   // PlaylistThumbnailDownloader::Delegate overrides:
   // Called when thumbnail image file is downloaded.
@@ -194,9 +216,16 @@ class PlaylistService : public KeyedService,
 
   base::SequencedTaskRunner* task_runner();
 
+  void OnDatabaseInitialized(bool success);
+  void OnDatabaseLoaded(PlaylistDatabase::Contents contents);
+  void OnPlaylistsLoaded();
+
+  // Runs |task| now, or once playlists have been loaded.
+  void RunWhenReady(base::OnceClosure task);
+
   void CleanUpMalformedPlaylistItems();
 
-  // Delete orphaned playlist item directories that are not included in prefs.
+  // Delete orphaned playlist item directories that are not included in db.
   void CleanUpOrphanedPlaylistItemDirs();
   void OnGetOrphanedPaths(const std::vector<base::FilePath> paths);
 
@@ -205,7 +234,10 @@ class PlaylistService : public KeyedService,
   void UpdatePlaylistItemValue(const std::string& id, base::Value value);
   void RemovePlaylistItemValue(const std::string& id);
 
-  bool HasPrefStorePlaylistItem(const std::string& id) const;
+  // Writes |playlist| with its item order to the database.
+  void SavePlaylist(const base::Value::Dict& playlist);
+
+  bool HasPlaylistItem(const std::string& id) const;
 
   // Playlist creation can be ready to play two steps.
   // Step 1. When creation is requested, requested info is put to db and
@@ -220,6 +252,8 @@ class PlaylistService : public KeyedService,
 
   void OnGetMetadata(base::Value value);
 
+  void CreatePlaylistImpl(const std::string& id, const std::string& name);
+
   content::WebContents* GetBackgroundWebContentsForTesting();
 
   std::string GetDefaultSaveTargetListID();
@@ -236,6 +270,20 @@ class PlaylistService : public KeyedService,
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   raw_ptr<PrefService> prefs_ = nullptr;
 
+  base::SequenceBound<PlaylistDatabase> database_;
+
+  // In-memory copy of the database, in the layout of the former
+  // kPlaylistsPref and kPlaylistItemsPref.
+  base::Value::Dict playlists_;
+  base::Value::Dict items_;
+
+  // Set when the database couldn't be opened. The prefs are used as storage
+  // then, as they were before the database existed.
+  bool use_prefs_storage_ = false;
+
+  bool ready_ = false;
+  std::vector<base::OnceClosure> pending_tasks_;
+
   base::WeakPtrFactory<PlaylistService> weak_factory_{this};
 };
 
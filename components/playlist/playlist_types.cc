@@ -29,6 +29,8 @@ std::string PlaylistChangeParams::GetPlaylistChangeTypeAsString(
       return "list: created";
     case PlaylistChangeParams::Type::kAllDeleted:
       return "item: all deleted";
+    case PlaylistChangeParams::Type::kAllLoaded:
+      return "list: all loaded";
     case PlaylistChangeParams::Type::kNone:
       [[fallthrough]];
     default:
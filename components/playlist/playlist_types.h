@@ -29,6 +29,7 @@ struct PlaylistChangeParams {
     kListCreated,  // A list is created
     kListRemoved,  // A list is removed
     kAllDeleted,   // All playlist are deleted
+    kAllLoaded,    // All playlists are loaded from the database
   };
   static std::string GetPlaylistChangeTypeAsString(Type type);
 
@@ -8,6 +8,9 @@
 
 namespace playlist {
 
+// kPlaylistsPref and kPlaylistItemsPref are only read to import them into
+// PlaylistDatabase, and are cleared afterwards.
+//
 // Set of playlists. Each playlist has ids of its items
 // so that playlists can share same item efficiently
 // Currently, List type preference always has to be updated entirely but there
@@ -28,6 +28,10 @@ class API {
     return this.#pageHandler.getPlaylist(id)
   }
 
+  async getPlaylistItems (playlistId: string, offset: number, count: number) {
+    return this.#pageHandler.getPlaylistItems(playlistId, offset, count)
+  }
+
   createPlaylist (playlist: PlaylistMojo.Playlist) {
     this.#pageHandler.createPlaylist(playlist)
   }
@@ -131,15 +131,15 @@ void BatLedgerImpl::OnPostData(const std::string& url,
       url, first_party_url, referrer, post_data, std::move(visit_data));
 }
 
-void BatLedgerImpl::OnXHRLoad(
-    uint32_t tab_id,
-    const std::string& url,
-    const base::flat_map<std::string, std::string>& parts,
-    const std::string& first_party_url,
-    const std::string& referrer,
-    ledger::mojom::VisitDataPtr visit_data) {
-  ledger_->OnXHRLoad(tab_id, url, parts, first_party_url, referrer,
-                     std::move(visit_data));
+void BatLedgerImpl::OnXHRLoads(uint32_t tab_id,
+                               std::vector<mojom::XHRLoadPtr> loads) {
+  for (const auto& load : loads) {
+    auto visit_data = ledger::mojom::VisitData::New();
+    visit_data->path = load->url;
+    visit_data->tab_id = tab_id;
+    ledger_->OnXHRLoad(tab_id, load->url, load->parts, load->first_party_url,
+                       load->referrer, std::move(visit_data));
+  }
 }
 
 void BatLedgerImpl::SetPublisherExclude(const std::string& publisher_key,
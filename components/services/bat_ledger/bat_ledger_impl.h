@@ -68,12 +68,8 @@ class BatLedgerImpl :
                   const std::string& referrer,
                   const std::string& post_data,
                   ledger::mojom::VisitDataPtr visit_data) override;
-  void OnXHRLoad(uint32_t tab_id,
-                 const std::string& url,
-                 const base::flat_map<std::string, std::string>& parts,
-                 const std::string& first_party_url,
-                 const std::string& referrer,
-                 ledger::mojom::VisitDataPtr visit_data) override;
+  void OnXHRLoads(uint32_t tab_id,
+                  std::vector<mojom::XHRLoadPtr> loads) override;
 
   void SetPublisherExclude(const std::string& publisher_key,
                            ledger::mojom::PublisherExclude exclude,
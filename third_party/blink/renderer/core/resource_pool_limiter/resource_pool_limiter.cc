@@ -10,7 +10,7 @@
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/platform/weborigin/security_origin.h"
 #include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
-#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 
 namespace blink {
 
@@ -34,16 +34,15 @@ const SecurityOrigin* GetTopFrameOrContextSecurityOrigin(
   return context->GetSecurityOrigin()->GetOriginOrPrecursorOriginIfOpaque();
 }
 
-String GetResourceIdInUse(const SecurityOrigin* origin,
-                          ResourcePoolLimiter::ResourceType resource_type) {
+String GetOriginIdInUse(const SecurityOrigin* origin) {
   DCHECK(origin);
-  StringBuilder string_builder;
-  string_builder.AppendNumber(static_cast<int>(resource_type));
   String origin_id = origin->RegistrableDomain();
   if (origin_id.empty())
     origin_id = origin->Host();
-  string_builder.Append(origin_id);
-  return string_builder.ToString();
+  // Null strings can't be used as HashMap keys.
+  if (origin_id.IsNull())
+    origin_id = g_empty_string;
+  return origin_id;
 }
 
 int GetResourceLimit(ResourcePoolLimiter::ResourceType resource_type) {
@@ -58,8 +57,12 @@ int GetResourceLimit(ResourcePoolLimiter::ResourceType resource_type) {
 }  // namespace
 
 ResourcePoolLimiter::ResourceInUseTracker::ResourceInUseTracker(
-    String resource_id)
-    : resource_id_(std::move(resource_id)) {}
+    ResourceType resource_type,
+    size_t shard_index,
+    StringImpl* origin_key)
+    : resource_type_(resource_type),
+      shard_index_(shard_index),
+      origin_key_(origin_key) {}
 
 ResourcePoolLimiter::ResourceInUseTracker::~ResourceInUseTracker() {
   ResourcePoolLimiter::GetInstance().DropResourceInUse(this);
@@ -82,30 +85,48 @@ ResourcePoolLimiter::IssueResourceInUseTracker(
     ExecutionContext* context,
     ResourcePoolLimiter::ResourceType resource_type) {
   DCHECK(context);
-  String resource_id = GetResourceIdInUse(
-      GetTopFrameOrContextSecurityOrigin(context), resource_type);
+  return IssueResourceInUseTrackerForOrigin(
+      GetOriginIdInUse(GetTopFrameOrContextSecurityOrigin(context)),
+      resource_type);
+}
 
-  base::AutoLock locker(resources_in_use_lock_);
-  // `insert` doesn't change the value if it already exists.
-  int& resource_in_use_count =
-      resources_in_use_.insert(resource_id, 0).stored_value->value;
+std::unique_ptr<ResourcePoolLimiter::ResourceInUseTracker>
+ResourcePoolLimiter::IssueResourceInUseTrackerForOrigin(
+    const String& origin_id,
+    ResourcePoolLimiter::ResourceType resource_type) {
+  DCHECK(!origin_id.IsNull());
+  const size_t shard_index =
+      static_cast<size_t>(resource_type) * kShardCountPerResourceType +
+      origin_id.Impl()->GetHash() % kShardCountPerResourceType;
+  ResourcesInUseShard& shard = shards_[shard_index];
+
+  base::AutoLock locker(shard.lock);
+  auto resource_in_use_it = shard.resources_in_use.find(origin_id);
+  if (resource_in_use_it == shard.resources_in_use.end()) {
+    // Keys outlive the thread which created them, so they must be isolated.
+    resource_in_use_it =
+        shard.resources_in_use.insert(origin_id.IsolatedCopy(), 0)
+            .stored_value;
+  }
+  int& resource_in_use_count = resource_in_use_it->value;
   if (resource_in_use_count >= GetResourceLimit(resource_type)) {
     return nullptr;
   }
 
   ++resource_in_use_count;
   return std::make_unique<ResourceInUseTracker>(
-      resource_id.Impl()->IsolatedCopy());
+      resource_type, shard_index, resource_in_use_it->key.Impl());
 }
 
 void ResourcePoolLimiter::DropResourceInUse(
     const ResourceInUseTracker* resource_in_use_tracker) {
-  base::AutoLock locker(resources_in_use_lock_);
-  auto resource_in_use_it =
-      resources_in_use_.find(resource_in_use_tracker->resource_id());
-  DCHECK(resource_in_use_it != resources_in_use_.end());
+  ResourcesInUseShard& shard = shards_[resource_in_use_tracker->shard_index()];
+  base::AutoLock locker(shard.lock);
+  auto resource_in_use_it = shard.resources_in_use.find(
+      String(resource_in_use_tracker->origin_key()));
+  DCHECK(resource_in_use_it != shard.resources_in_use.end());
   if (--resource_in_use_it->value == 0) {
-    resources_in_use_.erase(resource_in_use_it);
+    shard.resources_in_use.erase(resource_in_use_it);
   }
 }
 
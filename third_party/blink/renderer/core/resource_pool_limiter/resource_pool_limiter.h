@@ -6,6 +6,8 @@
 #ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_RESOURCE_POOL_LIMITER_RESOURCE_POOL_LIMITER_H_
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_RESOURCE_POOL_LIMITER_RESOURCE_POOL_LIMITER_H_
 
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -23,17 +25,27 @@ class CORE_EXPORT ResourcePoolLimiter {
  public:
   enum class ResourceType {
     kWebSocket,
+    kMaxValue = kWebSocket,
   };
 
   class CORE_EXPORT ResourceInUseTracker {
    public:
-    explicit ResourceInUseTracker(String resource_id);
+    ResourceInUseTracker(ResourceType resource_type,
+                         size_t shard_index,
+                         StringImpl* origin_key);
     ~ResourceInUseTracker();
 
-    const String& resource_id() const { return resource_id_; }
+    ResourceType resource_type() const { return resource_type_; }
+    size_t shard_index() const { return shard_index_; }
+    StringImpl* origin_key() const { return origin_key_; }
 
    private:
-    String resource_id_;
+    ResourceType resource_type_;
+    size_t shard_index_;
+    // Key of the origin's entry in the shard. The entry, and so the key, is
+    // kept alive by this tracker's count. Only referenced under the shard
+    // lock, because the key is shared between threads.
+    StringImpl* origin_key_;
   };
 
   static ResourcePoolLimiter& GetInstance();
@@ -47,12 +59,31 @@ class CORE_EXPORT ResourcePoolLimiter {
       ResourceType resource_type);
 
  private:
+  friend class ResourcePoolLimiterTest;
+
+  // Resources in use are sharded by resource type and origin hash, so that
+  // windows and workers opening resources for different origins don't contend
+  // on a single lock.
+  static constexpr size_t kShardCountPerResourceType = 16;
+  static constexpr size_t kShardCount =
+      (static_cast<size_t>(ResourceType::kMaxValue) + 1) *
+      kShardCountPerResourceType;
+
+  struct ResourcesInUseShard {
+    base::Lock lock;
+    // Counts of resources in use keyed by origin id.
+    HashMap<String, int> resources_in_use GUARDED_BY(lock);
+  };
+
   ResourcePoolLimiter();
 
+  std::unique_ptr<ResourceInUseTracker> IssueResourceInUseTrackerForOrigin(
+      const String& origin_id,
+      ResourceType resource_type);
+
   void DropResourceInUse(const ResourceInUseTracker* resource_in_use_tracker);
 
-  base::Lock resources_in_use_lock_;
-  HashMap<String, int> resources_in_use_ GUARDED_BY(resources_in_use_lock_);
+  std::array<ResourcesInUseShard, kShardCount> shards_;
 };
 
 }  // namespace blink
@@ -0,0 +1,111 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/resource_pool_limiter/resource_pool_limiter.h"
+
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace blink {
+
+namespace {
+
+using ResourceType = ResourcePoolLimiter::ResourceType;
+using ResourceInUseTracker = ResourcePoolLimiter::ResourceInUseTracker;
+
+constexpr int kWebSocketLimit = 30;
+
+}  // namespace
+
+// ResourcePoolLimiter is a process-wide singleton, so every test uses its own
+// origins and releases its trackers before it ends.
+class ResourcePoolLimiterTest : public testing::Test {
+ protected:
+  static std::unique_ptr<ResourceInUseTracker> Issue(const String& origin_id) {
+    return ResourcePoolLimiter::GetInstance()
+        .IssueResourceInUseTrackerForOrigin(origin_id,
+                                            ResourceType::kWebSocket);
+  }
+
+  static size_t GetShardCountPerResourceType() {
+    return ResourcePoolLimiter::kShardCountPerResourceType;
+  }
+
+  // Issues trackers for |origin_id| until the limit is reached.
+  static void IssueAll(const String& origin_id,
+                       std::vector<std::unique_ptr<ResourceInUseTracker>>*
+                           resource_in_use_trackers) {
+    for (int i = 0; i < kWebSocketLimit; ++i) {
+      auto resource_in_use_tracker = Issue(origin_id);
+      ASSERT_TRUE(resource_in_use_tracker);
+      resource_in_use_trackers->push_back(std::move(resource_in_use_tracker));
+    }
+  }
+};
+
+TEST_F(ResourcePoolLimiterTest, LimitsEachOriginSeparately) {
+  // Enough origins to spread over several shards.
+  constexpr int kOriginCount = 64;
+
+  std::vector<std::unique_ptr<ResourceInUseTracker>> resource_in_use_trackers;
+  for (int i = 0; i < kOriginCount; ++i) {
+    const String origin_id = String::Format("limits-origin%d.com", i);
+    IssueAll(origin_id, &resource_in_use_trackers);
+    EXPECT_FALSE(Issue(origin_id));
+  }
+
+  std::set<size_t> shard_indices;
+  for (const auto& resource_in_use_tracker : resource_in_use_trackers) {
+    EXPECT_EQ(ResourceType::kWebSocket,
+              resource_in_use_tracker->resource_type());
+    // Web sockets only use the shards of their own resource type.
+    EXPECT_LT(resource_in_use_tracker->shard_index(),
+              GetShardCountPerResourceType());
+    shard_indices.insert(resource_in_use_tracker->shard_index());
+  }
+  EXPECT_GT(shard_indices.size(), 1u);
+}
+
+TEST_F(ResourcePoolLimiterTest, SameOriginSharesShardAndLimit) {
+  const String origin_id = "shared-origin.com";
+
+  std::vector<std::unique_ptr<ResourceInUseTracker>> resource_in_use_trackers;
+  IssueAll(origin_id, &resource_in_use_trackers);
+  // A separately allocated copy of the origin id counts against the same
+  // limit.
+  EXPECT_FALSE(Issue(origin_id.IsolatedCopy()));
+
+  for (const auto& resource_in_use_tracker : resource_in_use_trackers) {
+    EXPECT_EQ(resource_in_use_trackers.front()->shard_index(),
+              resource_in_use_tracker->shard_index());
+  }
+}
+
+TEST_F(ResourcePoolLimiterTest, ReleasesResourcesInUse) {
+  const String origin_id = "release-origin.com";
+
+  std::vector<std::unique_ptr<ResourceInUseTracker>> resource_in_use_trackers;
+  IssueAll(origin_id, &resource_in_use_trackers);
+  EXPECT_FALSE(Issue(origin_id));
+
+  resource_in_use_trackers.pop_back();
+  auto resource_in_use_tracker = Issue(origin_id);
+  EXPECT_TRUE(resource_in_use_tracker);
+  EXPECT_FALSE(Issue(origin_id));
+
+  // Dropping every tracker removes the origin, and the full limit is
+  // available again.
+  resource_in_use_tracker.reset();
+  resource_in_use_trackers.clear();
+  IssueAll(origin_id, &resource_in_use_trackers);
+  EXPECT_FALSE(Issue(origin_id));
+}
+
+}  // namespace blink
@@ -7,6 +7,9 @@
 
 #include <limits.h>
 
+#include <algorithm>
+
+#include "base/check_op.h"
 #include "third_party/blink/renderer/platform/audio/audio_utilities.h"
 
 namespace blink {
@@ -19,6 +22,52 @@ inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
+constexpr size_t kNoiseBlockSize = 64;
+
+// Fills |destination| with the noise used by max farbling. The LFSR states are
+// stepped a block at a time, and then scaled in a separate loop which has no
+// dependency between iterations, so that the conversions and divisions of
+// several samples overlap instead of waiting on the LFSR.
+void GenerateNoise(uint64_t seed, float* destination, size_t len) {
+  uint64_t v = seed;
+  uint64_t states[kNoiseBlockSize];
+  for (size_t offset = 0; offset < len; offset += kNoiseBlockSize) {
+    const size_t block_size = std::min(kNoiseBlockSize, len - offset);
+    for (size_t i = 0; i < block_size; ++i) {
+      v = lfsr_next(v);
+      states[i] = v;
+    }
+    for (size_t i = 0; i < block_size; ++i) {
+      destination[offset + i] = (states[i] / maxUInt64AsDouble) / 10;
+    }
+  }
+}
+
+// RealtimeAnalyser reads the last |len| samples written to its ring buffer.
+// They wrap around to the start of the buffer at most once, so they are
+// visited as two contiguous spans rather than with a modulo per sample, which
+// lets the loops be vectorized.
+template <typename T, typename Function>
+void TransformRingBuffer(const float* input_buffer,
+                         T* destination,
+                         size_t len,
+                         unsigned write_index,
+                         unsigned fft_size,
+                         unsigned input_buffer_size,
+                         Function function) {
+  // Buffer access is protected as long as the spans don't overlap.
+  CHECK_LE(len, input_buffer_size);
+  const size_t start =
+      (size_t{write_index} + input_buffer_size - fft_size) % input_buffer_size;
+  const size_t head_len = std::min<size_t>(len, input_buffer_size - start);
+  for (size_t i = 0; i < head_len; ++i) {
+    destination[i] = function(input_buffer[start + i]);
+  }
+  for (size_t i = head_len; i < len; ++i) {
+    destination[i] = function(input_buffer[i - head_len]);
+  }
+}
+
 }  // namespace
 
 BraveAudioFarblingHelper::BraveAudioFarblingHelper(double fudge_factor,
@@ -31,11 +80,7 @@ BraveAudioFarblingHelper::~BraveAudioFarblingHelper() = default;
 void BraveAudioFarblingHelper::FarbleAudioChannel(float* dst,
                                                   size_t count) const {
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < count; i++) {
-      v = lfsr_next(v);
-      dst[i] = (v / maxUInt64AsDouble) / 10;
-    }
+    GenerateNoise(seed_, dst, count);
   } else {
     for (size_t i = 0; i < count; i++) {
       dst[i] = dst[i] * fudge_factor_;
@@ -52,22 +97,12 @@ void BraveAudioFarblingHelper::FarbleFloatTimeDomainData(
     unsigned fft_size,
     unsigned input_buffer_size) const {
   if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float value = (v / maxUInt64AsDouble) / 10;
-      destination[i] = value;
-    }
+    GenerateNoise(seed_, destination, len);
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      destination[i] = value;
-    }
+    TransformRingBuffer(input_buffer, destination, len, write_index, fft_size,
+                        input_buffer_size, [this](float input) -> float {
+                          return fudge_factor_ * input;
+                        });
   }
 }
 
@@ -99,26 +134,24 @@ void BraveAudioFarblingHelper::FarbleByteTimeDomainData(
       destination[i] = static_cast<unsigned char>(scaled_value);
     }
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      // Scale from nominal -1 -> +1 to unsigned byte.
-      double scaled_value = 128 * (value + 1);
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
-    }
+    TransformRingBuffer(
+        input_buffer, destination, len, write_index, fft_size,
+        input_buffer_size, [this](float input) -> unsigned char {
+          float value = fudge_factor_ * input;
+
+          // Scale from nominal -1 -> +1 to unsigned byte.
+          double scaled_value = 128 * (value + 1);
+
+          // Clip to valid range.
+          if (scaled_value < 0) {
+            scaled_value = 0;
+          }
+          if (scaled_value > UCHAR_MAX) {
+            scaled_value = UCHAR_MAX;
+          }
+
+          return static_cast<unsigned char>(scaled_value);
+        });
   }
 }
 
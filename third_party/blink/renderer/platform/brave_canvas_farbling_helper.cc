@@ -0,0 +1,91 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
+
+#include <string.h>
+
+#include "base/check.h"
+#include "base/strings/string_piece.h"
+#include "crypto/hmac.h"
+
+namespace blink {
+namespace {
+
+constexpr uint64_t zero = 0;
+
+inline uint64_t lfsr_next(uint64_t v) {
+  return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+}
+
+}  // namespace
+
+BraveCanvasFarblingHelper::BraveCanvasFarblingHelper(uint64_t key)
+    : key_(key) {}
+
+BraveCanvasFarblingHelper::~BraveCanvasFarblingHelper() = default;
+
+void BraveCanvasFarblingHelper::PerturbPixels(uint8_t* pixels, size_t size) {
+  if (!pixels || size == 0)
+    return;
+
+  // This needs to be type size_t because we pass it to base::StringPiece
+  // later for content hashing. This is safe because the maximum canvas
+  // dimensions are less than SIZE_T_MAX. (Width and height are each
+  // limited to 32,767 pixels.)
+  // Four bits per pixel
+  const size_t pixel_count = size / 4;
+  // calculate initial seed to find first pixel to perturb, based on session
+  // key, domain key, and canvas contents
+  ComputeCanvasKey(pixels, size);
+  uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key_);
+  uint64_t pixel_index;
+  // choose which channel (R, G, or B) to perturb
+  uint8_t channel;
+  // iterate through 32-byte canvas key and use each bit to determine how to
+  // perturb the current pixel
+  for (size_t i = 0; i < kCanvasKeySize; i++) {
+    uint8_t bit = canvas_key_[i];
+    for (int j = 0; j < 16; j++) {
+      if (j % 8 == 0)
+        bit = canvas_key_[i];
+      channel = v % 3;
+      pixel_index = 4 * (v % pixel_count) + channel;
+      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
+      bit = bit >> 1;
+      // find next pixel to perturb
+      v = lfsr_next(v);
+    }
+  }
+}
+
+void BraveCanvasFarblingHelper::ComputeCanvasKey(const uint8_t* pixels,
+                                                 size_t size) {
+  // Only reuse the key if the pixels are exactly the ones it was computed
+  // for. Comparing the bytes is far cheaper than the HMAC and, unlike a
+  // fingerprint, can't be fooled into reusing the key for another canvas.
+  if (canvas_.size() == size && memcmp(canvas_.data(), pixels, size) == 0)
+    return;
+
+  uint8_t previous_canvas_key[kCanvasKeySize];
+  memcpy(previous_canvas_key, canvas_key_, sizeof previous_canvas_key);
+
+  crypto::HMAC h(crypto::HMAC::SHA256);
+  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&key_), sizeof key_));
+  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(pixels), size),
+               canvas_key_, sizeof canvas_key_));
+
+  // Matching keys mean that the previous readback had the same pixels, so the
+  // canvas is likely to be read back unchanged again.
+  if (size <= kMaxCachedCanvasSize &&
+      memcmp(previous_canvas_key, canvas_key_, sizeof canvas_key_) == 0) {
+    canvas_.assign(pixels, pixels + size);
+  } else {
+    canvas_.clear();
+    canvas_.shrink_to_fit();
+  }
+}
+
+}  // namespace blink
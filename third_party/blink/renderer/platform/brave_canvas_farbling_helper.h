@@ -0,0 +1,48 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "third_party/blink/renderer/platform/platform_export.h"
+
+namespace blink {
+
+class PLATFORM_EXPORT BraveCanvasFarblingHelper final {
+ public:
+  explicit BraveCanvasFarblingHelper(uint64_t key);
+  ~BraveCanvasFarblingHelper();
+
+  // Flips bits of up to 512 color channels of |pixels|, which holds RGBA
+  // pixels. The pixels to perturb are chosen by an HMAC of the pixels keyed
+  // with |key|, so that identical canvases are always perturbed identically.
+  void PerturbPixels(uint8_t* pixels, size_t size);
+
+ private:
+  static constexpr size_t kCanvasKeySize = 32;
+  // Large enough for a full HD canvas.
+  static constexpr size_t kMaxCachedCanvasSize = 8 * 1024 * 1024;
+
+  void ComputeCanvasKey(const uint8_t* pixels, size_t size);
+
+  uint64_t key_;
+
+  // Pages often read back the same canvas content repeatedly, so once the same
+  // pixels (before perturbation) have been read back twice in a row a copy of
+  // them is kept, and the HMAC is reused for as long as they are unchanged.
+  // Canvases which change between readbacks, i.e. in animation loops, are
+  // never copied.
+  std::vector<uint8_t> canvas_;
+  uint8_t canvas_key_[kCanvasKeySize] = {};
+};
+
+}  // namespace blink
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
@@ -0,0 +1,94 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/timer/lap_timer.h"
+#include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace blink {
+
+namespace {
+
+constexpr double kFudgeFactor = 0.995;
+constexpr uint64_t kSeed = 12345;
+
+// Matches RealtimeAnalyser, whose ring buffer holds twice the maximum FFT
+// size.
+constexpr unsigned kInputBufferSize = 2 * 32768;
+
+constexpr int kWarmupRuns = 5;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 10;
+
+std::vector<float> BuildSamples(size_t count) {
+  std::vector<float> samples(count);
+  for (size_t i = 0; i < count; ++i) {
+    samples[i] = static_cast<float>(i % 200) / 100 - 1;
+  }
+  return samples;
+}
+
+template <typename FarbleFunction>
+void RunTest(const std::string& story, FarbleFunction farble) {
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    farble();
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+
+  perf_test::PerfResultReporter reporter("BraveAudioFarblingHelper", story);
+  reporter.RegisterImportantMetric(".time_per_call", "us");
+  reporter.AddResult(".time_per_call", timer.TimePerLap().InMicrosecondsF());
+}
+
+void RunAudioChannelTest(const std::string& story, bool max, size_t count) {
+  const BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, max);
+  std::vector<float> channel = BuildSamples(count);
+  RunTest(story, [&helper, &channel]() {
+    helper.FarbleAudioChannel(channel.data(), channel.size());
+  });
+}
+
+void RunFloatTimeDomainDataTest(const std::string& story,
+                                bool max,
+                                unsigned fft_size) {
+  const BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, max);
+  const std::vector<float> input_buffer = BuildSamples(kInputBufferSize);
+  std::vector<float> destination(fft_size);
+  // Read back a window which wraps around the end of the ring buffer.
+  const unsigned write_index = fft_size / 2;
+  RunTest(story, [&]() {
+    helper.FarbleFloatTimeDomainData(input_buffer.data(), destination.data(),
+                                     destination.size(), write_index, fft_size,
+                                     kInputBufferSize);
+  });
+}
+
+}  // namespace
+
+TEST(BraveAudioFarblingHelperPerfTest, FarbleAudioChannel) {
+  // A render quantum and a one second buffer at 48kHz.
+  RunAudioChannelTest("balanced_128", false, 128);
+  RunAudioChannelTest("balanced_48000", false, 48000);
+  RunAudioChannelTest("max_128", true, 128);
+  RunAudioChannelTest("max_48000", true, 48000);
+}
+
+TEST(BraveAudioFarblingHelperPerfTest, FarbleFloatTimeDomainData) {
+  // The default and maximum AnalyserNode FFT sizes.
+  RunFloatTimeDomainDataTest("balanced_2048", false, 2048);
+  RunFloatTimeDomainDataTest("balanced_32768", false, 32768);
+  RunFloatTimeDomainDataTest("max_2048", true, 2048);
+  RunFloatTimeDomainDataTest("max_32768", true, 32768);
+}
+
+}  // namespace blink
@@ -0,0 +1,98 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kSeed = 0x0123456789abcdef;
+constexpr double kFudgeFactor = 0.5;
+
+// Max farbling noise for |kSeed| from the algorithm that was used before the
+// noise was generated in blocks. There are more samples than fit in a block.
+std::vector<float> GetExpectedNoise() {
+  return {
+      0.000222222225f, 0.000111111112f, 0.050055556f, 0.0750277787f,
+      0.0375138894f, 0.0187569447f, 0.00937847234f, 0.054689236f, 0.0773446187f,
+      0.0386723094f, 0.0693361536f, 0.0346680768f, 0.067334041f, 0.0336670205f,
+      0.0168335102f, 0.00841675512f, 0.0542083792f, 0.0771041885f, 0.088552095f,
+      0.0942760482f, 0.0971380249f, 0.0985690132f, 0.0492845066f, 0.0746422559f,
+      0.037321128f, 0.0686605647f, 0.0843302831f, 0.0421651416f, 0.0210825708f,
+      0.0605412871f, 0.0302706435f, 0.0151353218f, 0.00756766088f,
+      0.0537838303f, 0.0268919151f, 0.0634459555f, 0.0317229778f, 0.0658614859f,
+      0.0829307437f, 0.0914653689f, 0.0957326889f, 0.0978663415f, 0.0489331707f,
+      0.0244665854f, 0.0622332916f, 0.0811166465f, 0.0905583203f, 0.0452791601f,
+      0.0726395771f, 0.0363197885f, 0.0181598943f, 0.0590799488f, 0.079539977f,
+      0.0397699885f, 0.0698849931f, 0.0849424973f, 0.0424712487f, 0.0212356243f,
+      0.0106178122f, 0.00530890608f, 0.00265445304f, 0.00132722652f,
+      0.00066361326f, 0.00033180663f, 0.0501659028f, 0.0250829514f,
+  };
+}
+
+// A ring buffer of 16 samples with the last 8 written ones wrapping around its
+// end, because the write index is less than the FFT size.
+constexpr unsigned kInputBufferSize = 16;
+constexpr unsigned kFFTSize = 8;
+constexpr unsigned kWriteIndex = 3;
+
+std::vector<float> BuildInputBuffer() {
+  std::vector<float> input_buffer(kInputBufferSize);
+  for (size_t i = 0; i < input_buffer.size(); ++i) {
+    input_buffer[i] = (static_cast<float>(i) - 8) / 8;
+  }
+  return input_buffer;
+}
+
+}  // namespace
+
+TEST(BraveAudioFarblingHelperTest, FarbleAudioChannelWithMaxNoise) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, /*max=*/true);
+  std::vector<float> channel(GetExpectedNoise().size(), 1.0f);
+  helper.FarbleAudioChannel(channel.data(), channel.size());
+  EXPECT_EQ(GetExpectedNoise(), channel);
+}
+
+TEST(BraveAudioFarblingHelperTest, FarbleFloatTimeDomainDataWithMaxNoise) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, /*max=*/true);
+  std::vector<float> destination(GetExpectedNoise().size());
+  helper.FarbleFloatTimeDomainData(nullptr, destination.data(),
+                                   destination.size(), 0, 0, 0);
+  EXPECT_EQ(GetExpectedNoise(), destination);
+}
+
+TEST(BraveAudioFarblingHelperTest, FarbleFloatTimeDomainDataWraps) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, /*max=*/false);
+  const std::vector<float> input_buffer = BuildInputBuffer();
+  std::vector<float> destination(kFFTSize);
+  helper.FarbleFloatTimeDomainData(input_buffer.data(), destination.data(),
+                                   destination.size(), kWriteIndex, kFFTSize,
+                                   kInputBufferSize);
+  // Samples 11 to 15, then 0 to 2, scaled by |kFudgeFactor|.
+  const std::vector<float> expected = {0.1875f, 0.25f,   0.3125f,  0.375f,
+                                       0.4375f, -0.5f,  -0.4375f, -0.375f};
+  EXPECT_EQ(expected, destination);
+}
+
+TEST(BraveAudioFarblingHelperTest, FarbleByteTimeDomainDataWraps) {
+  BraveAudioFarblingHelper helper(kFudgeFactor, kSeed, /*max=*/false);
+  const std::vector<float> input_buffer = BuildInputBuffer();
+  std::vector<unsigned char> destination(kFFTSize);
+  helper.FarbleByteTimeDomainData(input_buffer.data(), destination.data(),
+                                  destination.size(), kWriteIndex, kFFTSize,
+                                  kInputBufferSize);
+  const std::vector<unsigned char> expected = {152, 160, 168, 176,
+                                               184, 64,  72,  80};
+  EXPECT_EQ(expected, destination);
+}
+
+}  // namespace blink
@@ -0,0 +1,73 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/timer/lap_timer.h"
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kKey = 12345;
+constexpr int kWarmupRuns = 5;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+constexpr int kTimeCheckInterval = 10;
+
+std::vector<uint8_t> BuildCanvas(size_t width, size_t height) {
+  std::vector<uint8_t> canvas(width * height * 4);
+  for (size_t i = 0; i < canvas.size(); ++i) {
+    canvas[i] = static_cast<uint8_t>(i * 31 + i / 7);
+  }
+  return canvas;
+}
+
+// Reads back |canvas| like getImageData does, i.e. copies the pixels and
+// perturbs the copy. If |is_animated| the canvas is redrawn between readbacks.
+void RunTest(const std::string& story,
+             size_t width,
+             size_t height,
+             bool is_animated) {
+  std::vector<uint8_t> canvas = BuildCanvas(width, height);
+  std::vector<uint8_t> readback(canvas.size());
+  BraveCanvasFarblingHelper helper(kKey);
+
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    if (is_animated) {
+      canvas[timer.NumLaps() % canvas.size()]++;
+    }
+    readback = canvas;
+    helper.PerturbPixels(readback.data(), readback.size());
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+
+  perf_test::PerfResultReporter reporter("BraveCanvasFarblingHelper", story);
+  reporter.RegisterImportantMetric(".time_per_readback", "us");
+  reporter.AddResult(".time_per_readback",
+                     timer.TimePerLap().InMicrosecondsF());
+}
+
+}  // namespace
+
+TEST(BraveCanvasFarblingHelperPerfTest, UnchangedCanvas) {
+  RunTest("unchanged_300x150", 300, 150, false);
+  RunTest("unchanged_1920x1080", 1920, 1080, false);
+  RunTest("unchanged_4096x4096", 4096, 4096, false);
+}
+
+TEST(BraveCanvasFarblingHelperPerfTest, AnimatedCanvas) {
+  RunTest("animated_300x150", 300, 150, true);
+  RunTest("animated_1920x1080", 1920, 1080, true);
+  RunTest("animated_4096x4096", 4096, 4096, true);
+}
+
+}  // namespace blink
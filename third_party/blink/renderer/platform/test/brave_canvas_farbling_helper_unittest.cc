@@ -0,0 +1,125 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kKey = 12345;
+
+// 8x4 RGBA pixels.
+std::vector<uint8_t> BuildCanvas() {
+  std::vector<uint8_t> canvas(8 * 4 * 4);
+  for (size_t i = 0; i < canvas.size(); ++i) {
+    canvas[i] = static_cast<uint8_t>(i * 31 + i / 7);
+  }
+  return canvas;
+}
+
+// BuildCanvas() perturbed with |kKey| by the algorithm that was used before
+// the helper was split out of BraveSessionCache.
+std::vector<uint8_t> GetExpectedPerturbedCanvas() {
+  return {
+      0x00, 0x1f, 0x3f, 0x5d, 0x7c, 0x9a, 0xbb, 0xda,
+      0xf8, 0x18, 0x37, 0x56, 0x74, 0x94, 0xb4, 0xd3,
+      0xf2, 0x10, 0x30, 0x4f, 0x6e, 0x8e, 0xac, 0xcc,
+      0xeb, 0x0a, 0x29, 0x48, 0x68, 0x86, 0xa6, 0xc5,
+      0xe5, 0x02, 0x23, 0x42, 0x60, 0x80, 0x9e, 0xbe,
+      0xdc, 0xfd, 0x1d, 0x3b, 0x5a, 0x79, 0x98, 0xb7,
+      0xd7, 0xf6, 0x15, 0x34, 0x53, 0x72, 0x90, 0xb0,
+      0xd1, 0xef, 0x0f, 0x2d, 0x4d, 0x6a, 0x8a, 0xaa,
+      0xc8, 0xe8, 0x07, 0x26, 0x44, 0x65, 0x84, 0xa3,
+      0xc2, 0xe0, 0x00, 0x1f, 0x3f, 0x5e, 0x7c, 0x9c,
+      0xba, 0xda, 0xf8, 0x18, 0x38, 0x57, 0x76, 0x95,
+      0xb5, 0xd3, 0xf2, 0x12, 0x30, 0x51, 0x6e, 0x8e,
+      0xad, 0xcd, 0xed, 0x0b, 0x2b, 0x49, 0x68, 0x87,
+      0xa7, 0xc7, 0xe4, 0x04, 0x23, 0x43, 0x61, 0x80,
+      0xa0, 0xbf, 0xde, 0xfd, 0x1c, 0x3a, 0x5b, 0x7a,
+      0x99, 0xb9, 0xd6, 0xf6, 0x15, 0x35, 0x54, 0x73,
+  };
+}
+
+std::vector<uint8_t> Perturb(BraveCanvasFarblingHelper* helper,
+                             std::vector<uint8_t> pixels) {
+  helper->PerturbPixels(pixels.data(), pixels.size());
+  return pixels;
+}
+
+}  // namespace
+
+TEST(BraveCanvasFarblingHelperTest, MatchesPreviousAlgorithm) {
+  BraveCanvasFarblingHelper helper(kKey);
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+}
+
+TEST(BraveCanvasFarblingHelperTest, ReusesKeyForUnchangedCanvas) {
+  BraveCanvasFarblingHelper helper(kKey);
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+}
+
+TEST(BraveCanvasFarblingHelperTest, RecomputesKeyForChangedCanvas) {
+  std::vector<uint8_t> changed_canvas = BuildCanvas();
+  changed_canvas[changed_canvas.size() - 1]++;
+
+  BraveCanvasFarblingHelper fresh_helper(kKey);
+  const std::vector<uint8_t> expected = Perturb(&fresh_helper, changed_canvas);
+
+  BraveCanvasFarblingHelper helper(kKey);
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+  EXPECT_EQ(expected, Perturb(&helper, changed_canvas));
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+}
+
+TEST(BraveCanvasFarblingHelperTest, ReusesKeyForRepeatedlyUnchangedCanvas) {
+  BraveCanvasFarblingHelper helper(kKey);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+  }
+}
+
+TEST(BraveCanvasFarblingHelperTest, RecomputesKeyForChangedCanvasAfterReuse) {
+  std::vector<uint8_t> changed_canvas = BuildCanvas();
+  changed_canvas[0]++;
+
+  BraveCanvasFarblingHelper fresh_helper(kKey);
+  const std::vector<uint8_t> expected = Perturb(&fresh_helper, changed_canvas);
+
+  BraveCanvasFarblingHelper helper(kKey);
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+  EXPECT_EQ(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+  EXPECT_EQ(expected, Perturb(&helper, changed_canvas));
+}
+
+TEST(BraveCanvasFarblingHelperTest, PerturbsLargeCanvasIdentically) {
+  // 2048x2048 RGBA pixels, which is too large to be kept.
+  std::vector<uint8_t> canvas(2048 * 2048 * 4);
+  for (size_t i = 0; i < canvas.size(); ++i) {
+    canvas[i] = static_cast<uint8_t>(i * 31 + i / 7);
+  }
+
+  BraveCanvasFarblingHelper fresh_helper(kKey);
+  const std::vector<uint8_t> expected = Perturb(&fresh_helper, canvas);
+
+  BraveCanvasFarblingHelper helper(kKey);
+  EXPECT_EQ(expected, Perturb(&helper, canvas));
+  EXPECT_EQ(expected, Perturb(&helper, canvas));
+  EXPECT_EQ(expected, Perturb(&helper, canvas));
+}
+
+TEST(BraveCanvasFarblingHelperTest, DependsOnKey) {
+  BraveCanvasFarblingHelper helper(kKey + 1);
+  EXPECT_NE(GetExpectedPerturbedCanvas(), Perturb(&helper, BuildCanvas()));
+}
+
+}  // namespace blink